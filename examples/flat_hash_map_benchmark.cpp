@@ -0,0 +1,89 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares ext::flat_hash_map against std::unordered_map on lookup-heavy
+// work: a table built once and then probed many times, with a mix of
+// hits and misses.
+//
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stl2/container/flat_hash_map.hpp>
+
+namespace rng = std::experimental::ranges;
+
+namespace {
+	template <class F>
+	double time_ms(F&& f) {
+		auto const start = std::chrono::steady_clock::now();
+		f();
+		auto const stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(stop - start).count();
+	}
+
+	template <class Map, class Key>
+	long long lookups(const std::vector<Key>& keys, const std::vector<Key>& probes,
+		int rounds, double& build_ms)
+	{
+		Map m;
+		build_ms = time_ms([&]{
+			long long i = 0;
+			for (auto&& k : keys) {
+				m.emplace(k, i++);
+			}
+		});
+		long long sum = 0;
+		for (int r = 0; r < rounds; ++r) {
+			for (auto&& k : probes) {
+				auto const i = m.find(k);
+				sum += i == m.end() ? -1 : i->second;
+			}
+		}
+		return sum;
+	}
+
+	template <class Key, class F>
+	void compare(const char* name, int n, F&& make_key) {
+		std::vector<Key> keys, probes;
+		unsigned x = 42;
+		for (int i = 0; i < n; ++i) {
+			keys.push_back(make_key(i));
+		}
+		for (int i = 0; i < 1000000; ++i) {
+			x = x * 1103515245u + 12345u;
+			probes.push_back(make_key(static_cast<int>((x >> 4) % static_cast<unsigned>(2 * n))));
+		}
+		double fb = 0, ub = 0;
+		long long a = 0, b = 0;
+		auto const tf = time_ms([&]{
+			a = lookups<rng::ext::flat_hash_map<Key, long long>>(keys, probes, 4, fb);
+		});
+		auto const tu = time_ms([&]{
+			b = lookups<std::unordered_map<Key, long long>>(keys, probes, 4, ub);
+		});
+		std::printf("%-7s n=%-8d build: flat %7.2f ms  std %7.2f ms   "
+			"4M finds: flat %7.2f ms  std %7.2f ms   %s\n",
+			name, n, fb, ub, tf - fb, tu - ub, a == b ? "" : "MISMATCH");
+	}
+}
+
+int main() {
+	for (int n : {1000, 100000, 1000000}) {
+		compare<long long>("int", n, [](int i) { return i * 2654435761ll; });
+	}
+	for (int n : {1000, 100000, 1000000}) {
+		compare<std::string>("string", n, [](int i) {
+			return "key/" + std::to_string(i * 7919ll);
+		});
+	}
+}
@@ -0,0 +1,104 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares the throughput of ext::hash_value against std::hash on
+// std::string keys of various lengths, and of ext::hash_range on a
+// std::vector<int>, which it hashes as bytes, against the
+// element-by-element fold it uses for projected elements.
+//
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+#include <stl2/detail/hash_value.hpp>
+
+namespace rng = std::experimental::ranges;
+
+namespace {
+	template <class F>
+	double time_ms(F&& f) {
+		auto const start = std::chrono::steady_clock::now();
+		f();
+		auto const stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(stop - start).count();
+	}
+
+	double gb_per_s(std::size_t bytes, double ms) {
+		return bytes / (ms * 1e6);
+	}
+
+	void strings(std::size_t len) {
+		std::vector<std::string> keys;
+		for (int i = 0; i < 64; ++i) {
+			std::string s(len, 'a');
+			for (std::size_t j = 0; j < len; ++j) {
+				s[j] = static_cast<char>('a' + (i * 31 + j * 7) % 26);
+			}
+			keys.push_back(s);
+		}
+		auto const rounds = (std::size_t{1} << 30) / (len * keys.size()) + 1;
+		auto const bytes = rounds * keys.size() * len;
+		std::size_t a = 0, b = 0;
+		auto const th = time_ms([&]{
+			for (std::size_t r = 0; r < rounds; ++r) {
+				for (auto&& k : keys) {
+					a += rng::ext::hash_value(k);
+				}
+			}
+		});
+		auto const ts = time_ms([&]{
+			std::hash<std::string> h;
+			for (std::size_t r = 0; r < rounds; ++r) {
+				for (auto&& k : keys) {
+					b += h(k);
+				}
+			}
+		});
+		std::printf("string len=%-6zu hash_value %6.2f GB/s  std::hash %6.2f GB/s  (%zx)\n",
+			len, gb_per_s(bytes, th), gb_per_s(bytes, ts), a ^ b);
+	}
+
+	void ints(std::size_t n) {
+		std::vector<int> v(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			v[i] = static_cast<int>(i * 2654435761u);
+		}
+		auto const rounds = (std::size_t{1} << 28) / (n * sizeof(int)) + 1;
+		auto const bytes = rounds * n * sizeof(int);
+		std::size_t a = 0, b = 0;
+		auto const tb = time_ms([&]{
+			for (std::size_t r = 0; r < rounds; ++r) {
+				v[0] = static_cast<int>(r);
+				a += rng::ext::hash_range(v);
+			}
+		});
+		auto const tf = time_ms([&]{
+			for (std::size_t r = 0; r < rounds; ++r) {
+				v[0] = static_cast<int>(r);
+				// A projection other than identity is always folded.
+				b += rng::ext::hash_range(v, [](int i) { return i; });
+			}
+		});
+		std::printf("int    n=%-8zu bytes      %6.2f GB/s  fold      %6.2f GB/s  (%zx)\n",
+			n, gb_per_s(bytes, tb), gb_per_s(bytes, tf), a ^ b);
+	}
+}
+
+int main() {
+	for (std::size_t len : {8, 16, 64, 256, 1024, 65536}) {
+		strings(len);
+	}
+	for (std::size_t n : {256, 65536}) {
+		ints(n);
+	}
+}
@@ -0,0 +1,77 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares the time per element of stable_sort and of the parallel
+// inplace_merge and stable_partition with their temporary buffers drawn
+// from the heap and from a huge_page_scratch_resource, on ranges whose
+// buffers span many huge pages. Each run allocates a fresh buffer, so the
+// times include its page faults.
+//
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <stl2/algorithm.hpp>
+#include <stl2/detail/huge_page_resource.hpp>
+
+namespace rng = std::experimental::ranges;
+
+namespace {
+	template <class F>
+	double time_ms(F&& f) {
+		auto const start = std::chrono::steady_clock::now();
+		f();
+		auto const stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(stop - start).count();
+	}
+
+	void run(const char* name, rng::ext::scratch_resource& r,
+		const std::vector<std::uint64_t>& input)
+	{
+		auto const n = input.size();
+		auto halves = input;
+		std::sort(halves.begin(), halves.begin() + n / 2);
+		std::sort(halves.begin() + n / 2, halves.end());
+
+		auto v = input;
+		auto const ts = time_ms([&]{ rng::stable_sort(r, v); });
+		auto const tm = time_ms([&]{
+			rng::ext::scoped_scratch_resource _{r};
+			rng::inplace_merge(rng::ext::par, halves, halves.begin() + n / 2);
+		});
+		auto w = input;
+		auto const tp = time_ms([&]{
+			rng::ext::scoped_scratch_resource _{r};
+			rng::stable_partition(rng::ext::par, w,
+				[](std::uint64_t x) { return x % 2 == 0; });
+		});
+		auto const per = 1e6 / double(n);
+		std::printf("%-6s n=%-10zu stable_sort %6.2f  par inplace_merge %6.2f  "
+			"par stable_partition %6.2f ns/elt  (%d)\n", name, n, ts * per,
+			tm * per, tp * per, int(v[n / 2] == halves[n / 2] && w[0] % 2 == 0));
+	}
+}
+
+int main() {
+	std::mt19937_64 gen{42};
+	for (std::size_t n : {std::size_t{1} << 22, std::size_t{1} << 25}) {
+		std::vector<std::uint64_t> input(n);
+		for (auto& x : input) {
+			x = gen();
+		}
+		run("heap", *rng::ext::new_delete_scratch_resource(), input);
+		rng::ext::huge_page_scratch_resource huge;
+		run("huge", huge, input);
+	}
+}
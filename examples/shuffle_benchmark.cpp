@@ -0,0 +1,85 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares the time per element of shuffle against std::shuffle for
+// several generators and sizes, from cache-resident to memory-bound, and
+// of the bucketed shuffle with ext::seq and ext::par on large ranges.
+//
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <stl2/algorithm.hpp>
+#include <stl2/random.hpp>
+
+namespace rng = std::experimental::ranges;
+
+namespace {
+	template <class F>
+	double time_ms(F&& f) {
+		auto const start = std::chrono::steady_clock::now();
+		f();
+		auto const stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(stop - start).count();
+	}
+
+	template <class Gen>
+	void run(const char* name, std::size_t n) {
+		std::vector<std::uint32_t> v(n);
+		std::iota(v.begin(), v.end(), 0u);
+		auto const rounds = (std::size_t{1} << 26) / n + 1;
+		Gen g1{42}, g2{42};
+		auto const tr = time_ms([&]{
+			for (std::size_t r = 0; r < rounds; ++r) {
+				rng::shuffle(v, g1);
+			}
+		});
+		auto const ts = time_ms([&]{
+			for (std::size_t r = 0; r < rounds; ++r) {
+				std::shuffle(v.begin(), v.end(), g2);
+			}
+		});
+		auto const per = 1e6 / double(rounds * n);
+		std::printf("%-12s n=%-10zu shuffle %6.2f ns/elt  std::shuffle %6.2f ns/elt  (%u)\n",
+			name, n, tr * per, ts * per, v[n / 2]);
+	}
+
+	template <class Gen>
+	void sizes(const char* name) {
+		for (std::size_t n : {std::size_t{1} << 10, std::size_t{1} << 20,
+				std::size_t{1} << 26}) {
+			run<Gen>(name, n);
+		}
+	}
+
+	void bucketed(std::size_t n) {
+		std::vector<std::uint32_t> v(n);
+		std::iota(v.begin(), v.end(), 0u);
+		rng::ext::xoshiro256pp g{42};
+		auto const t1 = time_ms([&]{ rng::shuffle(v, g); });
+		auto const ts = time_ms([&]{ rng::shuffle(rng::ext::seq, v, g); });
+		auto const tp = time_ms([&]{ rng::shuffle(rng::ext::par, v, g); });
+		auto const per = 1e6 / double(n);
+		std::printf("xoshiro256pp n=%-10zu shuffle %6.2f  seq %6.2f  par %6.2f ns/elt  (%u)\n",
+			n, t1 * per, ts * per, tp * per, v[n / 2]);
+	}
+}
+
+int main() {
+	sizes<std::mt19937_64>("mt19937_64");
+	sizes<rng::ext::xoshiro256pp>("xoshiro256pp");
+	for (std::size_t n : {std::size_t{1} << 26, std::size_t{1} << 28}) {
+		bucketed(n);
+	}
+}
@@ -0,0 +1,83 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Compares ext::small_vector against std::vector for the common case of
+// short-lived lists that rarely outgrow a handful of elements.
+//
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <experimental/ranges/algorithm>
+#include <stl2/container/small_vector.hpp>
+
+namespace rng = std::experimental::ranges;
+
+namespace {
+	template <class F>
+	double time_ms(F&& f) {
+		auto const start = std::chrono::steady_clock::now();
+		f();
+		auto const stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(stop - start).count();
+	}
+
+	// Builds, sorts and sums many lists of n elements.
+	template <class Vector>
+	long long build_lists(int lists, int n) {
+		long long sum = 0;
+		for (int i = 0; i < lists; ++i) {
+			Vector v;
+			for (int j = 0; j < n; ++j) {
+				v.push_back((i * 7919 + j * 104729) % 1000);
+			}
+			rng::sort(v);
+			sum += v.front() + v.back();
+		}
+		return sum;
+	}
+
+	template <class Vector>
+	long long build_string_lists(int lists, int n) {
+		long long sum = 0;
+		for (int i = 0; i < lists; ++i) {
+			Vector v;
+			for (int j = 0; j < n; ++j) {
+				v.push_back(std::string(static_cast<std::size_t>(j % 8 + 1), static_cast<char>('a' + j % 26)));
+			}
+			sum += static_cast<long long>(v.back().size());
+		}
+		return sum;
+	}
+
+	template <class F, class G>
+	void compare(const char* name, int n, F&& f, G&& g) {
+		long long a = 0, b = 0;
+		auto const ts = time_ms([&]{ a = f(); });
+		auto const tv = time_ms([&]{ b = g(); });
+		std::printf("%-8s n=%-3d small_vector %8.2f ms   std::vector %8.2f ms   %s\n",
+			name, n, ts, tv, a == b ? "" : "MISMATCH");
+	}
+}
+
+int main() {
+	constexpr int lists = 1000000;
+	for (int n : {1, 4, 8, 16, 32, 64}) {
+		compare("int", n,
+			[=]{ return build_lists<rng::ext::small_vector<int, 16>>(lists, n); },
+			[=]{ return build_lists<std::vector<int>>(lists, n); });
+	}
+	for (int n : {4, 16, 32}) {
+		compare("string", n,
+			[=]{ return build_string_lists<rng::ext::small_vector<std::string, 16>>(lists / 4, n); },
+			[=]{ return build_string_lists<std::vector<std::string>>(lists / 4, n); });
+	}
+}
@@ -21,6 +21,8 @@
 #include <stl2/detail/algorithm/copy_backward.hpp>
 #include <stl2/detail/algorithm/copy_if.hpp>
 #include <stl2/detail/algorithm/copy_n.hpp>
+#include <stl2/detail/algorithm/distinct.hpp>
+#include <stl2/detail/algorithm/distinct_copy.hpp>
 #include <stl2/detail/algorithm/count.hpp>
 #include <stl2/detail/algorithm/count_if.hpp>
 #include <stl2/detail/algorithm/equal.hpp>
@@ -35,6 +37,9 @@
 #include <stl2/detail/algorithm/for_each.hpp>
 #include <stl2/detail/algorithm/generate.hpp>
 #include <stl2/detail/algorithm/generate_n.hpp>
+#include <stl2/detail/algorithm/generate_random.hpp>
+#include <stl2/detail/algorithm/hash_set_difference.hpp>
+#include <stl2/detail/algorithm/hash_set_intersection.hpp>
 #include <stl2/detail/algorithm/includes.hpp>
 #include <stl2/detail/algorithm/inplace_merge.hpp>
 #include <stl2/detail/algorithm/is_heap.hpp>
@@ -94,5 +99,7 @@
 #include <stl2/detail/algorithm/unique.hpp>
 #include <stl2/detail/algorithm/unique_copy.hpp>
 #include <stl2/detail/algorithm/upper_bound.hpp>
+#include <stl2/detail/algorithm/visit_each.hpp>
+#include <stl2/detail/algorithm/weighted_sample.hpp>
 
 #endif
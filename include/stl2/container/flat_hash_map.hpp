@@ -0,0 +1,364 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_CONTAINER_FLAT_HASH_MAP_HPP
+#define STL2_CONTAINER_FLAT_HASH_MAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/utility.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash.hpp>
+#include <stl2/detail/hash_value.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/swiss_table.hpp>
+#include <stl2/detail/concepts/compare.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/memory/relocate.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// flat_hash_map [Extension]
+// An unordered map that stores its entries in place in an open-addressing
+// table (see detail/swiss_table.hpp), with no allocation per entry.
+// Iterators are forward iterators to pair<const Key, T>; inserting may
+// rehash, which invalidates all of them, and erasing invalidates only
+// those to the erased entry. reserve(n) makes room for n entries up
+// front.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// As in SwissTable, an entry is relocated through pair<Key, T>, so
+		// that rehashing moves keys instead of copying them, but only when
+		// pair<Key, T> and pair<const Key, T> are standard-layout with their
+		// members at the same offsets. Otherwise the entry is moved as a
+		// pair<const Key, T>, which copies the key; when that copy might
+		// throw, swiss_table copies whole entries instead (see its resize).
+		template <class P, class CP>
+		constexpr bool pair_layout_matches = false;
+		template <class P, class CP>
+		requires
+			is_standard_layout<P>::value && is_standard_layout<CP>::value
+		constexpr bool pair_layout_matches<P, CP> =
+			sizeof(P) == sizeof(CP) &&
+			offsetof(P, first) == offsetof(CP, first) &&
+			offsetof(P, second) == offsetof(CP, second);
+
+		template <class Key, class T>
+		constexpr bool hash_map_slot_punnable =
+			pair_layout_matches<pair<Key, T>, pair<const Key, T>>;
+
+		template <class Key, class T>
+		union hash_map_slot {
+			pair<const Key, T> value;
+			pair<Key, T> mutable_value;
+
+			hash_map_slot() {}
+			~hash_map_slot() {}
+		};
+
+		template <class Key, class T>
+		struct hash_map_policy {
+			using key_type = Key;
+			using value_type = pair<const Key, T>;
+			using slot_type = hash_map_slot<Key, T>;
+
+			static const Key& key(const slot_type& s) noexcept { return s.value.first; }
+			static const Key& key_of(const value_type& v) noexcept { return v.first; }
+			static value_type& element(slot_type& s) noexcept { return s.value; }
+
+			template <class...Args>
+			static void construct(slot_type* s, Args&&...args) {
+				detail::construct(s->value, __stl2::forward<Args>(args)...);
+			}
+
+			static void destroy(slot_type* s) noexcept {
+				detail::destruct(s->value);
+			}
+
+			static constexpr bool nothrow_transfer = hash_map_slot_punnable<Key, T>
+				? nothrow_relocatable<pair<Key, T>>
+				: is_nothrow_move_constructible<value_type>::value;
+
+			static void transfer(true_type, slot_type* to, slot_type* from)
+			noexcept(nothrow_transfer)
+			{
+				detail::uninitialized_relocate_n(
+					&from->mutable_value, 1, &to->mutable_value);
+			}
+
+			static void transfer(false_type, slot_type* to, slot_type* from)
+			noexcept(nothrow_transfer)
+			{
+				detail::construct(to->value, __stl2::move(from->value));
+				detail::destruct(from->value);
+			}
+
+			static void transfer(slot_type* to, slot_type* from)
+			noexcept(nothrow_transfer)
+			{
+				hash_map_policy::transfer(
+					meta::bool_<hash_map_slot_punnable<Key, T>>{}, to, from);
+			}
+		};
+	}
+
+	namespace ext {
+		template <Movable Key, Movable T, class Hash = std::hash<Key>,
+			class Eq = equal_to<>>
+		requires
+			EqualityComparable<Key>() &&
+			detail::hash_function<Hash, Key> &&
+			Relation<Eq, Key>()
+		class flat_hash_map {
+			using policy_t = detail::hash_map_policy<Key, T>;
+			using slot_t = typename policy_t::slot_type;
+			using table_t = detail::swiss_table<policy_t, Hash, Eq>;
+			table_t table_;
+
+			template <class K>
+			static constexpr bool transparent =
+				detail::transparent_lookup<Hash, Eq, Key, K>;
+
+			template <class K, class...Args>
+			pair<typename table_t::iterator, bool> try_emplace_(K&& k, Args&&...args) {
+				return table_.find_or_emplace(k, [&](slot_t* s) {
+					policy_t::construct(s, std::piecewise_construct,
+						std::forward_as_tuple(__stl2::forward<K>(k)),
+						std::forward_as_tuple(__stl2::forward<Args>(args)...));
+				});
+			}
+
+		public:
+			using key_type = Key;
+			using mapped_type = T;
+			using value_type = pair<const Key, T>;
+			using hasher = Hash;
+			using key_equal = Eq;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = value_type&;
+			using const_reference = const value_type&;
+			using iterator = typename table_t::iterator;
+			using const_iterator = typename table_t::const_iterator;
+
+			flat_hash_map() = default;
+
+			explicit flat_hash_map(size_type n, const Hash& hash = Hash{},
+				const Eq& eq = Eq{})
+			: table_(n, hash, eq) {}
+
+			template <InputIterator I, Sentinel<I> S>
+			flat_hash_map(I first, S last, size_type n = 0,
+				const Hash& hash = Hash{}, const Eq& eq = Eq{})
+			: table_(n, hash, eq)
+			{
+				insert(__stl2::move(first), __stl2::move(last));
+			}
+
+			flat_hash_map(std::initializer_list<value_type> il, size_type n = 0,
+				const Hash& hash = Hash{}, const Eq& eq = Eq{})
+			requires CopyConstructible<Key>() && CopyConstructible<T>()
+			: flat_hash_map(il.begin(), il.end(), n, hash, eq) {}
+
+			iterator begin() noexcept { return table_.begin(); }
+			iterator end() noexcept { return table_.end(); }
+			const_iterator begin() const noexcept { return table_.begin(); }
+			const_iterator end() const noexcept { return table_.end(); }
+			const_iterator cbegin() const noexcept { return table_.begin(); }
+			const_iterator cend() const noexcept { return table_.end(); }
+
+			bool empty() const noexcept { return table_.empty(); }
+			size_type size() const noexcept { return table_.size(); }
+			size_type max_size() const noexcept { return table_.max_size(); }
+
+			size_type bucket_count() const noexcept { return table_.capacity(); }
+			float load_factor() const noexcept {
+				return bucket_count() == 0 ? 0.0f
+					: static_cast<float>(size()) / static_cast<float>(bucket_count());
+			}
+			float max_load_factor() const noexcept { return 0.875f; }
+			void reserve(size_type n) { table_.reserve(n); }
+			void rehash(size_type n) { table_.rehash(n); }
+
+			hasher hash_function() const { return table_.hash_function(); }
+			key_equal key_eq() const { return table_.key_eq(); }
+
+			template <class...Args>
+			requires Constructible<T, Args...>()
+			pair<iterator, bool> try_emplace(const Key& k, Args&&...args)
+			requires CopyConstructible<Key>()
+			{
+				return try_emplace_(k, __stl2::forward<Args>(args)...);
+			}
+
+			template <class...Args>
+			requires Constructible<T, Args...>()
+			pair<iterator, bool> try_emplace(Key&& k, Args&&...args) {
+				return try_emplace_(__stl2::move(k), __stl2::forward<Args>(args)...);
+			}
+
+			template <class K, class...Args>
+			requires
+				transparent<K> &&
+				Constructible<Key, K>() &&
+				Constructible<T, Args...>()
+			pair<iterator, bool> try_emplace(K&& k, Args&&...args) {
+				return try_emplace_(__stl2::forward<K>(k), __stl2::forward<Args>(args)...);
+			}
+
+			template <class M>
+			requires Assignable<T&, M>() && Constructible<T, M>()
+			pair<iterator, bool> insert_or_assign(Key k, M&& m) {
+				auto result = try_emplace_(__stl2::move(k), __stl2::forward<M>(m));
+				if (!result.second) {
+					result.first->second = __stl2::forward<M>(m);
+				}
+				return result;
+			}
+
+			pair<iterator, bool> insert(const value_type& v)
+			requires CopyConstructible<Key>() && CopyConstructible<T>()
+			{
+				return try_emplace_(v.first, v.second);
+			}
+
+			template <class P>
+			requires Constructible<pair<Key, T>, P>()
+			pair<iterator, bool> insert(P&& p) {
+				return emplace(__stl2::forward<P>(p));
+			}
+
+			// Builds the entry with a mutable key first, so that the key is
+			// moved into place.
+			template <class...Args>
+			requires Constructible<pair<Key, T>, Args...>()
+			pair<iterator, bool> emplace(Args&&...args) {
+				pair<Key, T> v{__stl2::forward<Args>(args)...};
+				return try_emplace_(__stl2::move(v.first), __stl2::move(v.second));
+			}
+
+			template <InputIterator I, Sentinel<I> S>
+			requires Constructible<pair<Key, T>, reference_t<I>>()
+			void insert(I first, S last) {
+				for (; first != last; ++first) {
+					emplace(*first);
+				}
+			}
+
+			void insert(std::initializer_list<value_type> il)
+			requires CopyConstructible<Key>() && CopyConstructible<T>()
+			{
+				insert(il.begin(), il.end());
+			}
+
+			T& operator[](const Key& k)
+			requires CopyConstructible<Key>() && DefaultConstructible<T>()
+			{
+				return try_emplace_(k).first->second;
+			}
+
+			T& operator[](Key&& k)
+			requires DefaultConstructible<T>()
+			{
+				return try_emplace_(__stl2::move(k)).first->second;
+			}
+
+			T& at(const Key& k) {
+				auto i = table_.find(k);
+				if (i == end()) {
+					throw std::out_of_range{"flat_hash_map::at"};
+				}
+				return i->second;
+			}
+
+			const T& at(const Key& k) const {
+				auto i = table_.find(k);
+				if (i == end()) {
+					throw std::out_of_range{"flat_hash_map::at"};
+				}
+				return i->second;
+			}
+
+			iterator erase(const_iterator i) noexcept {
+				return table_.erase(i);
+			}
+
+			size_type erase(const Key& k) { return table_.erase_key(k); }
+			template <class K>
+			requires transparent<K>
+			size_type erase(const K& k) { return table_.erase_key(k); }
+
+			void clear() noexcept { table_.clear(); }
+
+			void swap(flat_hash_map& that)
+			noexcept(noexcept(that.table_.swap(that.table_)))
+			{
+				table_.swap(that.table_);
+			}
+
+			friend void swap(flat_hash_map& x, flat_hash_map& y)
+			noexcept(noexcept(x.swap(y)))
+			{
+				x.swap(y);
+			}
+
+			iterator find(const Key& k) { return table_.find(k); }
+			const_iterator find(const Key& k) const { return table_.find(k); }
+			template <class K>
+			requires transparent<K>
+			iterator find(const K& k) { return table_.find(k); }
+			template <class K>
+			requires transparent<K>
+			const_iterator find(const K& k) const { return table_.find(k); }
+
+			bool contains(const Key& k) const { return table_.contains(k); }
+			template <class K>
+			requires transparent<K>
+			bool contains(const K& k) const { return table_.contains(k); }
+
+			size_type count(const Key& k) const { return contains(k) ? 1 : 0; }
+			template <class K>
+			requires transparent<K>
+			size_type count(const K& k) const { return contains(k) ? 1 : 0; }
+		};
+
+		template <class Key, EqualityComparable T, class Hash, class Eq>
+		bool operator==(const flat_hash_map<Key, T, Hash, Eq>& x,
+			const flat_hash_map<Key, T, Hash, Eq>& y)
+		{
+			if (x.size() != y.size()) {
+				return false;
+			}
+			for (auto&& e : x) {
+				auto const i = y.find(e.first);
+				if (i == y.end() || !(i->second == e.second)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		template <class Key, EqualityComparable T, class Hash, class Eq>
+		bool operator!=(const flat_hash_map<Key, T, Hash, Eq>& x,
+			const flat_hash_map<Key, T, Hash, Eq>& y)
+		{
+			return !(x == y);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,233 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_CONTAINER_FLAT_HASH_SET_HPP
+#define STL2_CONTAINER_FLAT_HASH_SET_HPP
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/utility.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash.hpp>
+#include <stl2/detail/hash_value.hpp>
+#include <stl2/detail/swiss_table.hpp>
+#include <stl2/detail/concepts/compare.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/memory/relocate.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// flat_hash_set [Extension]
+// An unordered set that stores its keys in place in an open-addressing
+// table (see detail/swiss_table.hpp), with no allocation per element.
+// Iterators are forward iterators to const keys; inserting may rehash,
+// which invalidates all of them, and erasing invalidates only those to
+// the erased element. reserve(n) makes room for n keys up front.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template <class Key>
+		struct hash_set_policy {
+			using key_type = Key;
+			using value_type = Key;
+			using slot_type = Key;
+
+			static const Key& key(const slot_type& s) noexcept { return s; }
+			static const Key& key_of(const value_type& v) noexcept { return v; }
+			static Key& element(slot_type& s) noexcept { return s; }
+
+			template <class...Args>
+			static void construct(slot_type* s, Args&&...args) {
+				detail::construct(*s, __stl2::forward<Args>(args)...);
+			}
+
+			static void destroy(slot_type* s) noexcept {
+				detail::destruct(*s);
+			}
+
+			static constexpr bool nothrow_transfer = nothrow_relocatable<Key>;
+
+			static void transfer(slot_type* to, slot_type* from)
+			noexcept(nothrow_transfer)
+			{
+				detail::uninitialized_relocate_n(from, 1, to);
+			}
+		};
+	}
+
+	namespace ext {
+		template <Movable Key, class Hash = std::hash<Key>, class Eq = equal_to<>>
+		requires
+			EqualityComparable<Key>() &&
+			detail::hash_function<Hash, Key> &&
+			Relation<Eq, Key>()
+		class flat_hash_set {
+			using table_t = detail::swiss_table<detail::hash_set_policy<Key>, Hash, Eq>;
+			table_t table_;
+
+			template <class K>
+			static constexpr bool transparent =
+				detail::transparent_lookup<Hash, Eq, Key, K>;
+
+		public:
+			using key_type = Key;
+			using value_type = Key;
+			using hasher = Hash;
+			using key_equal = Eq;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = const Key&;
+			using const_reference = const Key&;
+			using iterator = typename table_t::const_iterator;
+			using const_iterator = iterator;
+
+			flat_hash_set() = default;
+
+			explicit flat_hash_set(size_type n, const Hash& hash = Hash{},
+				const Eq& eq = Eq{})
+			: table_(n, hash, eq) {}
+
+			template <InputIterator I, Sentinel<I> S>
+			requires Constructible<Key, reference_t<I>>()
+			flat_hash_set(I first, S last, size_type n = 0,
+				const Hash& hash = Hash{}, const Eq& eq = Eq{})
+			: table_(n, hash, eq)
+			{
+				insert(__stl2::move(first), __stl2::move(last));
+			}
+
+			flat_hash_set(std::initializer_list<Key> il, size_type n = 0,
+				const Hash& hash = Hash{}, const Eq& eq = Eq{})
+			requires CopyConstructible<Key>()
+			: flat_hash_set(il.begin(), il.end(), n, hash, eq) {}
+
+			iterator begin() const noexcept { return table_.begin(); }
+			iterator end() const noexcept { return table_.end(); }
+			iterator cbegin() const noexcept { return table_.begin(); }
+			iterator cend() const noexcept { return table_.end(); }
+
+			bool empty() const noexcept { return table_.empty(); }
+			size_type size() const noexcept { return table_.size(); }
+			size_type max_size() const noexcept { return table_.max_size(); }
+
+			size_type bucket_count() const noexcept { return table_.capacity(); }
+			float load_factor() const noexcept {
+				return bucket_count() == 0 ? 0.0f
+					: static_cast<float>(size()) / static_cast<float>(bucket_count());
+			}
+			float max_load_factor() const noexcept { return 0.875f; }
+			void reserve(size_type n) { table_.reserve(n); }
+			void rehash(size_type n) { table_.rehash(n); }
+
+			hasher hash_function() const { return table_.hash_function(); }
+			key_equal key_eq() const { return table_.key_eq(); }
+
+			pair<iterator, bool> insert(const Key& k)
+			requires CopyConstructible<Key>()
+			{
+				return table_.find_or_emplace(k, [&](Key* s) {
+					detail::hash_set_policy<Key>::construct(s, k);
+				});
+			}
+
+			pair<iterator, bool> insert(Key&& k) {
+				return table_.find_or_emplace(k, [&](Key* s) {
+					detail::hash_set_policy<Key>::construct(s, __stl2::move(k));
+				});
+			}
+
+			template <class...Args>
+			requires Constructible<Key, Args...>()
+			pair<iterator, bool> emplace(Args&&...args) {
+				return insert(Key{__stl2::forward<Args>(args)...});
+			}
+
+			template <InputIterator I, Sentinel<I> S>
+			requires Constructible<Key, reference_t<I>>()
+			void insert(I first, S last) {
+				for (; first != last; ++first) {
+					emplace(*first);
+				}
+			}
+
+			void insert(std::initializer_list<Key> il)
+			requires CopyConstructible<Key>()
+			{
+				insert(il.begin(), il.end());
+			}
+
+			iterator erase(const_iterator i) noexcept {
+				return table_.erase(i);
+			}
+
+			size_type erase(const Key& k) { return table_.erase_key(k); }
+			template <class K>
+			requires transparent<K>
+			size_type erase(const K& k) { return table_.erase_key(k); }
+
+			void clear() noexcept { table_.clear(); }
+
+			void swap(flat_hash_set& that)
+			noexcept(noexcept(that.table_.swap(that.table_)))
+			{
+				table_.swap(that.table_);
+			}
+
+			friend void swap(flat_hash_set& x, flat_hash_set& y)
+			noexcept(noexcept(x.swap(y)))
+			{
+				x.swap(y);
+			}
+
+			iterator find(const Key& k) const { return table_.find(k); }
+			template <class K>
+			requires transparent<K>
+			iterator find(const K& k) const { return table_.find(k); }
+
+			bool contains(const Key& k) const { return table_.contains(k); }
+			template <class K>
+			requires transparent<K>
+			bool contains(const K& k) const { return table_.contains(k); }
+
+			size_type count(const Key& k) const { return contains(k) ? 1 : 0; }
+			template <class K>
+			requires transparent<K>
+			size_type count(const K& k) const { return contains(k) ? 1 : 0; }
+		};
+
+		template <class Key, class Hash, class Eq>
+		bool operator==(const flat_hash_set<Key, Hash, Eq>& x,
+			const flat_hash_set<Key, Hash, Eq>& y)
+		{
+			if (x.size() != y.size()) {
+				return false;
+			}
+			for (auto&& k : x) {
+				if (!y.contains(k)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		template <class Key, class Hash, class Eq>
+		bool operator!=(const flat_hash_set<Key, Hash, Eq>& x,
+			const flat_hash_set<Key, Hash, Eq>& y)
+		{
+			return !(x == y);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
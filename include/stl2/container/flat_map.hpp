@@ -0,0 +1,498 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_CONTAINER_FLAT_MAP_HPP
+#define STL2_CONTAINER_FLAT_MAP_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/utility.hpp>
+#include <stl2/detail/flat_common.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/algorithm/inplace_merge.hpp>
+#include <stl2/detail/algorithm/lower_bound.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/algorithm/unique.hpp>
+#include <stl2/detail/concepts/compare.hpp>
+#include <stl2/detail/concepts/function.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/range/range.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// flat_map [Extension]
+// A map kept as two parallel vectors, the sorted unique keys and their
+// mapped values. Lookups binary search the keys alone, so the values
+// never enter the cache during a search and the keys pack as densely as
+// they can. Iterators zip the two vectors: they are random access and
+// yield pair<const Key&, T&>, with pair<Key, T> as their value type.
+//
+// Bulk construction and batch insert append to both vectors, sort and
+// deduplicate the new entries through a writable zip of the tails, and
+// merge them into the existing entries with inplace_merge. Of several
+// entries with equivalent keys the first is kept: an existing entry
+// wins over an inserted one, as with repeated insert.
+//
+// Key and T must be Copyable: the iterators are proxies, and a proxy's
+// reference converts to the value type only by copying.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Iteration over the keys and values of a flat_map, yielding
+		// pair<const Key&, T&>.
+		template <class Key, class T, bool Const>
+		class flat_map_cursor {
+			friend flat_map_cursor<Key, T, !Const>;
+			using mapped_t = meta::if_c<Const, const T, T>;
+
+			const Key* key_ = nullptr;
+			mapped_t* value_ = nullptr;
+
+		public:
+			using value_type = pair<Key, T>;
+			using difference_type = std::ptrdiff_t;
+
+			flat_map_cursor() = default;
+			constexpr flat_map_cursor(const Key* k, mapped_t* v) noexcept
+			: key_{k}, value_{v} {}
+			constexpr flat_map_cursor(const flat_map_cursor<Key, T, !Const>& that) noexcept
+			requires Const
+			: key_{that.key_}, value_{that.value_} {}
+
+			constexpr pair<const Key&, mapped_t&> read() const noexcept {
+				return {*key_, *value_};
+			}
+			constexpr void next() noexcept { ++key_; ++value_; }
+			constexpr void prev() noexcept { --key_; --value_; }
+			constexpr void advance(difference_type n) noexcept {
+				key_ += n;
+				value_ += n;
+			}
+			constexpr difference_type distance_to(const flat_map_cursor& that) const noexcept {
+				return that.key_ - key_;
+			}
+			constexpr bool equal(const flat_map_cursor& that) const noexcept {
+				return key_ == that.key_;
+			}
+		};
+
+		// Writable zip of the keys and values of a flat_map, used to sort
+		// and merge entries.
+		template <class Key, class T>
+		class flat_map_zip_cursor {
+			Key* key_ = nullptr;
+			T* value_ = nullptr;
+
+		public:
+			using value_type = pair<Key, T>;
+			using difference_type = std::ptrdiff_t;
+
+			flat_map_zip_cursor() = default;
+			constexpr flat_map_zip_cursor(Key* k, T* v) noexcept
+			: key_{k}, value_{v} {}
+
+			constexpr pair<Key&, T&> read() const noexcept {
+				return {*key_, *value_};
+			}
+			constexpr pair<Key&&, T&&> indirect_move() const noexcept {
+				return {__stl2::move(*key_), __stl2::move(*value_)};
+			}
+			constexpr void next() noexcept { ++key_; ++value_; }
+			constexpr void prev() noexcept { --key_; --value_; }
+			constexpr void advance(difference_type n) noexcept {
+				key_ += n;
+				value_ += n;
+			}
+			constexpr difference_type distance_to(const flat_map_zip_cursor& that) const noexcept {
+				return that.key_ - key_;
+			}
+			constexpr bool equal(const flat_map_zip_cursor& that) const noexcept {
+				return key_ == that.key_;
+			}
+		};
+	}
+
+	namespace ext {
+		template <Copyable Key, Copyable T, class Comp = less<>>
+		requires StrictWeakOrder<Comp, Key>()
+		class flat_map {
+			using zip_iterator = basic_iterator<detail::flat_map_zip_cursor<Key, T>>;
+
+		public:
+			using key_type = Key;
+			using mapped_type = T;
+			using value_type = pair<Key, T>;
+			using key_compare = Comp;
+			using key_container_type = std::vector<Key>;
+			using mapped_container_type = std::vector<T>;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = pair<const Key&, T&>;
+			using const_reference = pair<const Key&, const T&>;
+			using iterator = basic_iterator<detail::flat_map_cursor<Key, T, false>>;
+			using const_iterator = basic_iterator<detail::flat_map_cursor<Key, T, true>>;
+			using reverse_iterator = __stl2::reverse_iterator<iterator>;
+			using const_reverse_iterator = __stl2::reverse_iterator<const_iterator>;
+
+		private:
+			key_container_type keys_;
+			mapped_container_type values_;
+			Comp comp_;
+
+			zip_iterator zip(size_type i) noexcept {
+				return zip_iterator{detail::flat_map_zip_cursor<Key, T>{keys_.data() + i, values_.data() + i}};
+			}
+
+			void truncate(size_type n) {
+				keys_.erase(keys_.begin() + n, keys_.end());
+				values_.erase(values_.begin() + n, values_.end());
+			}
+
+			// Sorts and deduplicates the entries [n, size()), then merges
+			// them into the sorted entries [0, n).
+			void merge_tail(size_type n) {
+				auto const equiv = detail::sorted_equivalent<Comp>{&comp_};
+				auto const first = zip(0);
+				auto const mid = zip(n);
+				auto last = zip(keys_.size());
+				__stl2::stable_sort(mid, last, __stl2::ref(comp_), detail::pair_first_fn{});
+				last = __stl2::unique(mid, last, equiv, detail::pair_first_fn{});
+				truncate(static_cast<size_type>(last - first));
+				if (n == 0 || n == keys_.size()) {
+					return;
+				}
+				__stl2::inplace_merge(first, mid, last, __stl2::ref(comp_),
+					detail::pair_first_fn{});
+				last = __stl2::unique(first, last, equiv, detail::pair_first_fn{});
+				truncate(static_cast<size_type>(last - first));
+			}
+
+			template <class K>
+			size_type lower_bound_(const K& k) const {
+				return static_cast<size_type>(__stl2::ext::branchless_lower_bound(
+					keys_, k, __stl2::ref(comp_)) - keys_.begin());
+			}
+
+			template <class K>
+			size_type upper_bound_(const K& k) const {
+				return static_cast<size_type>(__stl2::ext::branchless_lower_bound(
+					keys_, k, detail::not_after<Comp>{&comp_}) - keys_.begin());
+			}
+
+			template <class K>
+			bool equivalent_(size_type i, const K& k) const {
+				return i != keys_.size() && !comp_(k, keys_[i]);
+			}
+
+			iterator at_(size_type i) noexcept {
+				return iterator{detail::flat_map_cursor<Key, T, false>{keys_.data() + i, values_.data() + i}};
+			}
+
+			const_iterator at_(size_type i) const noexcept {
+				return const_iterator{detail::flat_map_cursor<Key, T, true>{keys_.data() + i, values_.data() + i}};
+			}
+
+			template <class K, class...Args>
+			pair<iterator, bool> try_emplace_(K&& k, Args&&...args) {
+				auto const i = lower_bound_(k);
+				if (equivalent_(i, k)) {
+					return {at_(i), false};
+				}
+				values_.emplace(values_.begin() + i, __stl2::forward<Args>(args)...);
+				try {
+					keys_.emplace(keys_.begin() + i, __stl2::forward<K>(k));
+				} catch(...) {
+					values_.erase(values_.begin() + i);
+					throw;
+				}
+				return {at_(i), true};
+			}
+
+		public:
+			flat_map() = default;
+
+			explicit flat_map(const Comp& comp)
+			: keys_{}, values_{}, comp_(comp) {}
+
+			// Pre: keys.size() == values.size().
+			flat_map(key_container_type keys, mapped_container_type values,
+				const Comp& comp = Comp{})
+			: keys_(__stl2::move(keys)), values_(__stl2::move(values)), comp_(comp)
+			{
+				STL2_ASSERT(keys_.size() == values_.size());
+				merge_tail(0);
+			}
+
+			// Pre: keys.size() == values.size(), and keys is sorted by comp
+			// and has no equivalent elements.
+			flat_map(sorted_unique_t, key_container_type keys,
+				mapped_container_type values, const Comp& comp = Comp{})
+			: keys_(__stl2::move(keys)), values_(__stl2::move(values)), comp_(comp)
+			{
+				STL2_ASSERT(keys_.size() == values_.size());
+			}
+
+			template <InputIterator I, Sentinel<I> S>
+			flat_map(I first, S last, const Comp& comp = Comp{})
+			: flat_map(comp)
+			{
+				insert(__stl2::move(first), __stl2::move(last));
+			}
+
+			flat_map(std::initializer_list<value_type> il, const Comp& comp = Comp{})
+			: flat_map(il.begin(), il.end(), comp) {}
+
+			iterator begin() noexcept { return at_(0); }
+			iterator end() noexcept { return at_(keys_.size()); }
+			const_iterator begin() const noexcept { return at_(0); }
+			const_iterator end() const noexcept { return at_(keys_.size()); }
+			const_iterator cbegin() const noexcept { return begin(); }
+			const_iterator cend() const noexcept { return end(); }
+			reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+			reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
+			const_reverse_iterator rbegin() const noexcept {
+				return const_reverse_iterator{end()};
+			}
+			const_reverse_iterator rend() const noexcept {
+				return const_reverse_iterator{begin()};
+			}
+			const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+			const_reverse_iterator crend() const noexcept { return rend(); }
+
+			bool empty() const noexcept { return keys_.empty(); }
+			size_type size() const noexcept { return keys_.size(); }
+			size_type max_size() const noexcept {
+				return keys_.max_size() < values_.max_size()
+					? keys_.max_size() : values_.max_size();
+			}
+			void reserve(size_type n) {
+				keys_.reserve(n);
+				values_.reserve(n);
+			}
+			void shrink_to_fit() {
+				keys_.shrink_to_fit();
+				values_.shrink_to_fit();
+			}
+
+			// The sorted keys, and the mapped values in the same order.
+			const key_container_type& keys() const noexcept { return keys_; }
+			const mapped_container_type& values() const noexcept { return values_; }
+
+			key_compare key_comp() const { return comp_; }
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			T& at(const K& k) {
+				auto const i = lower_bound_(k);
+				if (!equivalent_(i, k)) {
+					throw std::out_of_range{"flat_map::at"};
+				}
+				return values_[i];
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			const T& at(const K& k) const {
+				auto const i = lower_bound_(k);
+				if (!equivalent_(i, k)) {
+					throw std::out_of_range{"flat_map::at"};
+				}
+				return values_[i];
+			}
+
+			T& operator[](const Key& k)
+			requires DefaultConstructible<T>()
+			{
+				return (*try_emplace_(k).first).second;
+			}
+
+			T& operator[](Key&& k)
+			requires DefaultConstructible<T>()
+			{
+				return (*try_emplace_(__stl2::move(k)).first).second;
+			}
+
+			template <class...Args>
+			requires Constructible<T, Args...>()
+			pair<iterator, bool> try_emplace(const Key& k, Args&&...args) {
+				return try_emplace_(k, __stl2::forward<Args>(args)...);
+			}
+
+			template <class...Args>
+			requires Constructible<T, Args...>()
+			pair<iterator, bool> try_emplace(Key&& k, Args&&...args) {
+				return try_emplace_(__stl2::move(k), __stl2::forward<Args>(args)...);
+			}
+
+			template <class M>
+			requires Assignable<T&, M>() && Constructible<T, M>()
+			pair<iterator, bool> insert_or_assign(Key k, M&& m) {
+				auto const result = try_emplace_(__stl2::move(k), __stl2::forward<M>(m));
+				if (!result.second) {
+					(*result.first).second = __stl2::forward<M>(m);
+				}
+				return result;
+			}
+
+			pair<iterator, bool> insert(value_type v) {
+				return try_emplace_(__stl2::move(v.first), __stl2::move(v.second));
+			}
+
+			template <class...Args>
+			requires Constructible<value_type, Args...>()
+			pair<iterator, bool> emplace(Args&&...args) {
+				return insert(value_type(__stl2::forward<Args>(args)...));
+			}
+
+			template <InputIterator I, Sentinel<I> S>
+			void insert(I first, S last) {
+				auto const n = keys_.size();
+				try {
+					for (; first != last; ++first) {
+						value_type v(*first);
+						keys_.push_back(__stl2::move(v.first));
+						try {
+							values_.push_back(__stl2::move(v.second));
+						} catch(...) {
+							keys_.pop_back();
+							throw;
+						}
+					}
+				} catch(...) {
+					truncate(n);
+					throw;
+				}
+				merge_tail(n);
+			}
+
+			void insert(std::initializer_list<value_type> il)
+			{
+				insert(il.begin(), il.end());
+			}
+
+			iterator erase(const_iterator i) {
+				auto const n = i - cbegin();
+				keys_.erase(keys_.begin() + n);
+				values_.erase(values_.begin() + n);
+				return at_(static_cast<size_type>(n));
+			}
+
+			iterator erase(const_iterator first, const_iterator last) {
+				auto const lo = first - cbegin();
+				auto const hi = last - cbegin();
+				keys_.erase(keys_.begin() + lo, keys_.begin() + hi);
+				values_.erase(values_.begin() + lo, values_.begin() + hi);
+				return at_(static_cast<size_type>(lo));
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			size_type erase(const K& k) {
+				auto const i = lower_bound_(k);
+				if (!equivalent_(i, k)) {
+					return 0;
+				}
+				keys_.erase(keys_.begin() + i);
+				values_.erase(values_.begin() + i);
+				return 1;
+			}
+
+			void clear() noexcept {
+				keys_.clear();
+				values_.clear();
+			}
+
+			void swap(flat_map& that)
+			noexcept(is_nothrow_swappable_v<Comp&, Comp&>)
+			{
+				__stl2::swap(keys_, that.keys_);
+				__stl2::swap(values_, that.values_);
+				__stl2::swap(comp_, that.comp_);
+			}
+
+			friend void swap(flat_map& x, flat_map& y)
+			noexcept(noexcept(x.swap(y)))
+			{
+				x.swap(y);
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			iterator lower_bound(const K& k) { return at_(lower_bound_(k)); }
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			const_iterator lower_bound(const K& k) const { return at_(lower_bound_(k)); }
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			iterator upper_bound(const K& k) { return at_(upper_bound_(k)); }
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			const_iterator upper_bound(const K& k) const { return at_(upper_bound_(k)); }
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			ext::range<iterator> equal_range(const K& k) {
+				auto const i = lower_bound_(k);
+				return {at_(i), at_(equivalent_(i, k) ? i + 1 : i)};
+			}
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			ext::range<const_iterator> equal_range(const K& k) const {
+				auto const i = lower_bound_(k);
+				return {at_(i), at_(equivalent_(i, k) ? i + 1 : i)};
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			iterator find(const K& k) {
+				auto const i = lower_bound_(k);
+				return at_(equivalent_(i, k) ? i : keys_.size());
+			}
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			const_iterator find(const K& k) const {
+				auto const i = lower_bound_(k);
+				return at_(equivalent_(i, k) ? i : keys_.size());
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			bool contains(const K& k) const {
+				return equivalent_(lower_bound_(k), k);
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			size_type count(const K& k) const {
+				return contains(k) ? 1 : 0;
+			}
+		};
+
+		template <EqualityComparable Key, EqualityComparable T, class Comp>
+		bool operator==(const flat_map<Key, T, Comp>& x, const flat_map<Key, T, Comp>& y) {
+			return x.keys() == y.keys() && x.values() == y.values();
+		}
+
+		template <EqualityComparable Key, EqualityComparable T, class Comp>
+		bool operator!=(const flat_map<Key, T, Comp>& x, const flat_map<Key, T, Comp>& y) {
+			return !(x == y);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
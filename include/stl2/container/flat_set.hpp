@@ -0,0 +1,338 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_CONTAINER_FLAT_SET_HPP
+#define STL2_CONTAINER_FLAT_SET_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/utility.hpp>
+#include <stl2/detail/flat_common.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/inplace_merge.hpp>
+#include <stl2/detail/algorithm/lexicographical_compare.hpp>
+#include <stl2/detail/algorithm/lower_bound.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/algorithm/unique.hpp>
+#include <stl2/detail/concepts/compare.hpp>
+#include <stl2/detail/concepts/function.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/range/range.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// flat_set [Extension]
+// A set kept as a sorted vector of unique keys. Lookups are a branchless
+// binary search over contiguous keys; inserting one key is linear.
+// Construction from unsorted input sorts and removes duplicates once;
+// inserting a batch sorts the batch, merges it into the existing keys
+// with inplace_merge and removes duplicates, instead of shifting the
+// vector once per key. The first of several equivalent keys is the one
+// kept, as with repeated insert.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template <Movable Key, class Comp = less<>>
+		requires StrictWeakOrder<Comp, Key>()
+		class flat_set {
+		public:
+			using key_type = Key;
+			using value_type = Key;
+			using key_compare = Comp;
+			using value_compare = Comp;
+			using container_type = std::vector<Key>;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = const Key&;
+			using const_reference = const Key&;
+			using iterator = typename container_type::const_iterator;
+			using const_iterator = iterator;
+			using reverse_iterator = __stl2::reverse_iterator<iterator>;
+			using const_reverse_iterator = reverse_iterator;
+
+		private:
+			container_type keys_;
+			Comp comp_;
+
+			// Appends [first, last) to keys_; if that throws, removes what was
+			// appended, so that keys_ stays sorted and unique.
+			template <class I, class S>
+			void append_(I first, S last) {
+				auto const n = keys_.size();
+				try {
+					for (; first != last; ++first) {
+						keys_.emplace_back(*first);
+					}
+				} catch(...) {
+					keys_.erase(keys_.begin() + n, keys_.end());
+					throw;
+				}
+			}
+
+			// Sorts and deduplicates keys_[n, size()), then merges that run
+			// into the sorted keys_[0, n).
+			void merge_tail(size_type n) {
+				auto const equiv = detail::sorted_equivalent<Comp>{&comp_};
+				auto const mid = keys_.begin() + n;
+				__stl2::stable_sort(mid, keys_.end(), __stl2::ref(comp_));
+				keys_.erase(__stl2::unique(mid, keys_.end(), equiv), keys_.end());
+				if (n == 0 || n == keys_.size()) {
+					return;
+				}
+				auto const first = keys_.begin();
+				__stl2::inplace_merge(first, first + n, keys_.end(), __stl2::ref(comp_));
+				keys_.erase(__stl2::unique(keys_, equiv), keys_.end());
+			}
+
+			template <class K>
+			iterator lower_bound_(const K& k) const {
+				return __stl2::ext::branchless_lower_bound(keys_, k, __stl2::ref(comp_));
+			}
+
+			template <class K>
+			iterator upper_bound_(const K& k) const {
+				return __stl2::ext::branchless_lower_bound(
+					keys_, k, detail::not_after<Comp>{&comp_});
+			}
+
+			template <class K>
+			bool equivalent_(const_iterator i, const K& k) const {
+				return i != keys_.end() && !comp_(k, *i);
+			}
+
+		public:
+			flat_set() = default;
+
+			explicit flat_set(const Comp& comp)
+			: keys_{}, comp_(comp) {}
+
+			explicit flat_set(container_type keys, const Comp& comp = Comp{})
+			: keys_(__stl2::move(keys)), comp_(comp)
+			{
+				merge_tail(0);
+			}
+
+			// Pre: keys is sorted by comp and has no equivalent elements.
+			flat_set(sorted_unique_t, container_type keys, const Comp& comp = Comp{})
+			: keys_(__stl2::move(keys)), comp_(comp) {}
+
+			template <InputIterator I, Sentinel<I> S>
+			requires Constructible<Key, reference_t<I>>()
+			flat_set(I first, S last, const Comp& comp = Comp{})
+			: flat_set(comp)
+			{
+				insert(__stl2::move(first), __stl2::move(last));
+			}
+
+			flat_set(std::initializer_list<Key> il, const Comp& comp = Comp{})
+			requires CopyConstructible<Key>()
+			: flat_set(il.begin(), il.end(), comp) {}
+
+			flat_set& operator=(std::initializer_list<Key> il)
+			requires CopyConstructible<Key>()
+			{
+				clear();
+				insert(il);
+				return *this;
+			}
+
+			iterator begin() const noexcept { return keys_.begin(); }
+			iterator end() const noexcept { return keys_.end(); }
+			iterator cbegin() const noexcept { return keys_.begin(); }
+			iterator cend() const noexcept { return keys_.end(); }
+			reverse_iterator rbegin() const noexcept { return reverse_iterator{end()}; }
+			reverse_iterator rend() const noexcept { return reverse_iterator{begin()}; }
+			reverse_iterator crbegin() const noexcept { return rbegin(); }
+			reverse_iterator crend() const noexcept { return rend(); }
+
+			bool empty() const noexcept { return keys_.empty(); }
+			size_type size() const noexcept { return keys_.size(); }
+			size_type max_size() const noexcept { return keys_.max_size(); }
+			size_type capacity() const noexcept { return keys_.capacity(); }
+			void reserve(size_type n) { keys_.reserve(n); }
+			void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+			// The sorted keys.
+			const container_type& keys() const noexcept { return keys_; }
+			// Empties the set and returns its keys.
+			container_type extract() {
+				auto result = __stl2::move(keys_);
+				keys_.clear();
+				return result;
+			}
+
+			key_compare key_comp() const { return comp_; }
+			value_compare value_comp() const { return comp_; }
+
+			template <class...Args>
+			requires Constructible<Key, Args...>()
+			pair<iterator, bool> emplace(Args&&...args) {
+				return insert(Key(__stl2::forward<Args>(args)...));
+			}
+
+			pair<iterator, bool> insert(const Key& k)
+			requires CopyConstructible<Key>()
+			{
+				auto i = lower_bound_(k);
+				if (equivalent_(i, k)) {
+					return {i, false};
+				}
+				return {keys_.insert(i, k), true};
+			}
+
+			pair<iterator, bool> insert(Key&& k) {
+				auto i = lower_bound_(k);
+				if (equivalent_(i, k)) {
+					return {i, false};
+				}
+				return {keys_.insert(i, __stl2::move(k)), true};
+			}
+
+			template <InputIterator I, Sentinel<I> S>
+			requires Constructible<Key, reference_t<I>>()
+			void insert(I first, S last) {
+				auto const n = keys_.size();
+				append_(__stl2::move(first), __stl2::move(last));
+				merge_tail(n);
+			}
+
+			void insert(std::initializer_list<Key> il)
+			requires CopyConstructible<Key>()
+			{
+				insert(il.begin(), il.end());
+			}
+
+			// Pre: [first, last) is sorted by key_comp() and has no equivalent
+			// elements.
+			template <InputIterator I, Sentinel<I> S>
+			requires Constructible<Key, reference_t<I>>()
+			void insert(sorted_unique_t, I first, S last) {
+				auto const n = keys_.size();
+				append_(__stl2::move(first), __stl2::move(last));
+				if (n == 0 || n == keys_.size()) {
+					return;
+				}
+				auto const begin = keys_.begin();
+				__stl2::inplace_merge(begin, begin + n, keys_.end(), __stl2::ref(comp_));
+				keys_.erase(__stl2::unique(keys_,
+					detail::sorted_equivalent<Comp>{&comp_}), keys_.end());
+			}
+
+			iterator erase(const_iterator i) {
+				return keys_.erase(i);
+			}
+
+			iterator erase(const_iterator first, const_iterator last) {
+				return keys_.erase(first, last);
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			size_type erase(const K& k) {
+				auto const i = lower_bound_(k);
+				if (!equivalent_(i, k)) {
+					return 0;
+				}
+				keys_.erase(i);
+				return 1;
+			}
+
+			void clear() noexcept { keys_.clear(); }
+
+			void swap(flat_set& that)
+			noexcept(is_nothrow_swappable_v<Comp&, Comp&>)
+			{
+				__stl2::swap(keys_, that.keys_);
+				__stl2::swap(comp_, that.comp_);
+			}
+
+			friend void swap(flat_set& x, flat_set& y)
+			noexcept(noexcept(x.swap(y)))
+			{
+				x.swap(y);
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			iterator lower_bound(const K& k) const {
+				return lower_bound_(k);
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			iterator upper_bound(const K& k) const {
+				return upper_bound_(k);
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			ext::range<iterator> equal_range(const K& k) const {
+				auto const i = lower_bound_(k);
+				return {i, equivalent_(i, k) ? i + 1 : i};
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			iterator find(const K& k) const {
+				auto const i = lower_bound_(k);
+				return equivalent_(i, k) ? i : keys_.end();
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			bool contains(const K& k) const {
+				return equivalent_(lower_bound_(k), k);
+			}
+
+			template <class K>
+			requires IndirectCallableStrictWeakOrder<Comp, const K*, const Key*>()
+			size_type count(const K& k) const {
+				return contains(k) ? 1 : 0;
+			}
+		};
+
+		template <EqualityComparable Key, class Comp>
+		bool operator==(const flat_set<Key, Comp>& x, const flat_set<Key, Comp>& y) {
+			return x.keys() == y.keys();
+		}
+
+		template <EqualityComparable Key, class Comp>
+		bool operator!=(const flat_set<Key, Comp>& x, const flat_set<Key, Comp>& y) {
+			return !(x == y);
+		}
+
+		template <StrictTotallyOrdered Key, class Comp>
+		bool operator<(const flat_set<Key, Comp>& x, const flat_set<Key, Comp>& y) {
+			return x.keys() < y.keys();
+		}
+
+		template <StrictTotallyOrdered Key, class Comp>
+		bool operator>(const flat_set<Key, Comp>& x, const flat_set<Key, Comp>& y) {
+			return y < x;
+		}
+
+		template <StrictTotallyOrdered Key, class Comp>
+		bool operator<=(const flat_set<Key, Comp>& x, const flat_set<Key, Comp>& y) {
+			return !(y < x);
+		}
+
+		template <StrictTotallyOrdered Key, class Comp>
+		bool operator>=(const flat_set<Key, Comp>& x, const flat_set<Key, Comp>& y) {
+			return !(x < y);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,619 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_CONTAINER_SMALL_VECTOR_HPP
+#define STL2_CONTAINER_SMALL_VECTOR_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/utility.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/lexicographical_compare.hpp>
+#include <stl2/detail/algorithm/move.hpp>
+#include <stl2/detail/algorithm/move_backward.hpp>
+#include <stl2/detail/algorithm/rotate.hpp>
+#include <stl2/detail/concepts/compare.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/memory/destroy.hpp>
+#include <stl2/detail/memory/relocate.hpp>
+#include <stl2/detail/memory/uninitialized_copy.hpp>
+#include <stl2/detail/memory/uninitialized_fill.hpp>
+#include <stl2/detail/memory/uninitialized_value_construct.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// small_vector [Extension]
+// A vector that keeps up to N elements in storage inside the object and
+// only allocates once it grows past that. Its iterators are pointers, so
+// it is a contiguous, sized range that works with every algorithm and
+// with back_insert_iterator.
+//
+// Growing past the inline capacity, and moving a small_vector whose
+// elements are inline, relocate the elements (see
+// ext::is_trivially_relocatable): one memcpy for trivially relocatable
+// types. Moving a small_vector that has allocated just takes its
+// allocation. Either way a move invalidates iterators into the source.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template <Destructible T, std::size_t N>
+		requires _IsNot<T, is_array> && _IsNot<T, is_const>
+		class small_vector {
+		public:
+			using value_type = T;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = T&;
+			using const_reference = const T&;
+			using pointer = T*;
+			using const_pointer = const T*;
+			using iterator = T*;
+			using const_iterator = const T*;
+			using reverse_iterator = __stl2::reverse_iterator<iterator>;
+			using const_reverse_iterator = __stl2::reverse_iterator<const_iterator>;
+
+			static constexpr size_type inline_capacity = N;
+
+		private:
+			T* begin_;
+			T* end_;
+			T* alloc_;
+			alignas(T) unsigned char inline_[N > 0 ? N * sizeof(T) : 1];
+
+			T* inline_data() noexcept {
+				return reinterpret_cast<T*>(inline_);
+			}
+
+			static T* allocate(size_type n) {
+				return std::allocator<T>{}.allocate(n);
+			}
+
+			static void deallocate(T* p, size_type n) noexcept {
+				std::allocator<T>{}.deallocate(p, n);
+			}
+
+			void release() noexcept {
+				if (!is_inline()) {
+					deallocate(begin_, capacity());
+				}
+				begin_ = end_ = inline_data();
+				alloc_ = begin_ + N;
+			}
+
+			size_type next_capacity(size_type n) const {
+				if (n > max_size()) {
+					throw std::length_error{"small_vector too long"};
+				}
+				auto const cap = capacity();
+				auto want = cap < max_size() / 2 ? 2 * cap : max_size();
+				return want < n ? n : want;
+			}
+
+			// Moves the elements to a new allocation of n >= size() elements.
+			void reallocate(size_type n) {
+				STL2_ASSUME(n >= size());
+				T* const p = allocate(n);
+				T* e;
+				try {
+					e = detail::uninitialized_relocate_n(begin_, end_ - begin_, p);
+				} catch(...) {
+					deallocate(p, n);
+					throw;
+				}
+				end_ = begin_;
+				release();
+				begin_ = p;
+				end_ = e;
+				alloc_ = p + n;
+			}
+
+			// Pre: this vector is empty and inline; that's elements fit inline.
+			void steal(small_vector& that)
+			noexcept(detail::nothrow_relocatable<T>)
+			{
+				if (!that.is_inline()) {
+					begin_ = that.begin_;
+					end_ = that.end_;
+					alloc_ = that.alloc_;
+					that.begin_ = that.end_ = that.inline_data();
+					that.alloc_ = that.begin_ + N;
+					return;
+				}
+				end_ = detail::uninitialized_relocate_n(
+					that.begin_, that.end_ - that.begin_, begin_);
+				that.end_ = that.begin_;
+			}
+
+			template <class...Args>
+			T& emplace_back_slow(Args&&...args) {
+				auto const n = next_capacity(size() + 1);
+				T* const p = allocate(n);
+				T* const pos = p + size();
+				try {
+					// Construct the new element first: args may refer to an
+					// element of this vector.
+					detail::construct(*pos, __stl2::forward<Args>(args)...);
+					try {
+						detail::uninitialized_relocate_n(begin_, end_ - begin_, p);
+					} catch(...) {
+						detail::destruct(*pos);
+						throw;
+					}
+				} catch(...) {
+					deallocate(p, n);
+					throw;
+				}
+				end_ = begin_;
+				release();
+				begin_ = p;
+				end_ = pos + 1;
+				alloc_ = p + n;
+				return *pos;
+			}
+
+			void append_n(size_type n, const T& value) {
+				if (n > capacity() - size()) {
+					// value may refer to an element of this vector.
+					T tmp(value);
+					reallocate(next_capacity(size() + n));
+					end_ = __stl2::uninitialized_fill_n(end_, n, tmp);
+				} else {
+					end_ = __stl2::uninitialized_fill_n(end_, n, value);
+				}
+			}
+
+			template <class I, class S>
+			void append(false_type, I first, S last) {
+				for (; first != last; ++first) {
+					emplace_back(*first);
+				}
+			}
+
+			template <class I, class S>
+			void append(true_type, I first, S last) {
+				auto const n = static_cast<size_type>(__stl2::distance(first, last));
+				if (n > capacity() - size()) {
+					reallocate(next_capacity(size() + n));
+				}
+				end_ = __stl2::uninitialized_copy(
+					__stl2::move(first), __stl2::move(last), end_).out();
+			}
+
+			template <class I, class S>
+			void append(I first, S last) {
+				append(meta::bool_<models::ForwardIterator<I>>{},
+					__stl2::move(first), __stl2::move(last));
+			}
+
+			void truncate(T* p) noexcept {
+				__stl2::destroy(p, end_);
+				end_ = p;
+			}
+
+			// Moves the elements appended after old_size into place at
+			// offset off.
+			iterator rotate_into_place(difference_type off, size_type old_size) {
+				__stl2::rotate(begin_ + off, begin_ + old_size, end_);
+				return begin_ + off;
+			}
+
+		public:
+			small_vector() noexcept
+			: begin_{inline_data()}, end_{begin_}, alloc_{begin_ + N} {}
+
+			explicit small_vector(size_type n)
+			requires DefaultConstructible<T>()
+			: small_vector()
+			{
+				resize(n);
+			}
+
+			small_vector(size_type n, const T& value)
+			requires CopyConstructible<T>()
+			: small_vector()
+			{
+				assign(n, value);
+			}
+
+			template <InputIterator I, Sentinel<I> S>
+			requires Constructible<T, reference_t<I>>()
+			small_vector(I first, S last)
+			: small_vector()
+			{
+				append(__stl2::move(first), __stl2::move(last));
+			}
+
+			small_vector(std::initializer_list<T> il)
+			requires CopyConstructible<T>()
+			: small_vector(il.begin(), il.end()) {}
+
+			small_vector(const small_vector& that)
+			requires CopyConstructible<T>()
+			: small_vector(that.begin(), that.end()) {}
+
+			small_vector(small_vector&& that)
+			noexcept(detail::nothrow_relocatable<T>)
+			: small_vector()
+			{
+				steal(that);
+			}
+
+			~small_vector() {
+				__stl2::destroy(begin_, end_);
+				release();
+			}
+
+			small_vector& operator=(const small_vector& that)
+			requires CopyConstructible<T>() && Assignable<T&, const T&>()
+			{
+				if (this != &that) {
+					assign(that.begin(), that.end());
+				}
+				return *this;
+			}
+
+			small_vector& operator=(small_vector&& that)
+			noexcept(detail::nothrow_relocatable<T>)
+			{
+				if (this != &that) {
+					clear();
+					release();
+					steal(that);
+				}
+				return *this;
+			}
+
+			small_vector& operator=(std::initializer_list<T> il)
+			requires CopyConstructible<T>() && Assignable<T&, const T&>()
+			{
+				assign(il.begin(), il.end());
+				return *this;
+			}
+
+			template <InputIterator I, Sentinel<I> S>
+			requires
+				Constructible<T, reference_t<I>>() &&
+				Assignable<T&, reference_t<I>>()
+			void assign(I first, S last) {
+				auto i = begin_;
+				for (; i != end_ && first != last; ++i, ++first) {
+					*i = *first;
+				}
+				if (i != end_) {
+					truncate(i);
+				} else {
+					append(__stl2::move(first), __stl2::move(last));
+				}
+			}
+
+			void assign(size_type n, const T& value)
+			requires CopyConstructible<T>() && Assignable<T&, const T&>()
+			{
+				if (n > capacity()) {
+					small_vector tmp;
+					tmp.reserve(n);
+					tmp.end_ = __stl2::uninitialized_fill_n(tmp.begin_, n, value);
+					*this = __stl2::move(tmp);
+					return;
+				}
+				auto const common = n < size() ? n : size();
+				for (size_type i = 0; i < common; ++i) {
+					begin_[i] = value;
+				}
+				if (n < size()) {
+					truncate(begin_ + n);
+				} else {
+					end_ = __stl2::uninitialized_fill_n(end_, n - common, value);
+				}
+			}
+
+			void assign(std::initializer_list<T> il)
+			requires CopyConstructible<T>() && Assignable<T&, const T&>()
+			{
+				assign(il.begin(), il.end());
+			}
+
+			iterator begin() noexcept { return begin_; }
+			const_iterator begin() const noexcept { return begin_; }
+			iterator end() noexcept { return end_; }
+			const_iterator end() const noexcept { return end_; }
+			const_iterator cbegin() const noexcept { return begin_; }
+			const_iterator cend() const noexcept { return end_; }
+			reverse_iterator rbegin() noexcept { return reverse_iterator{end_}; }
+			const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{end_}; }
+			reverse_iterator rend() noexcept { return reverse_iterator{begin_}; }
+			const_reverse_iterator rend() const noexcept { return const_reverse_iterator{begin_}; }
+			const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+			const_reverse_iterator crend() const noexcept { return rend(); }
+
+			size_type size() const noexcept {
+				return static_cast<size_type>(end_ - begin_);
+			}
+			bool empty() const noexcept {
+				return begin_ == end_;
+			}
+			size_type capacity() const noexcept {
+				return static_cast<size_type>(alloc_ - begin_);
+			}
+			static constexpr size_type max_size() noexcept {
+				return static_cast<size_type>(
+					std::numeric_limits<difference_type>::max()) / sizeof(T);
+			}
+			// True if the elements are stored inside this object.
+			bool is_inline() const noexcept {
+				return begin_ == reinterpret_cast<const T*>(inline_);
+			}
+
+			T* data() noexcept { return begin_; }
+			const T* data() const noexcept { return begin_; }
+
+			T& operator[](size_type i) noexcept {
+				STL2_ASSUME(i < size());
+				return begin_[i];
+			}
+			const T& operator[](size_type i) const noexcept {
+				STL2_ASSUME(i < size());
+				return begin_[i];
+			}
+			T& at(size_type i) {
+				if (i >= size()) {
+					throw std::out_of_range{"small_vector::at"};
+				}
+				return begin_[i];
+			}
+			const T& at(size_type i) const {
+				if (i >= size()) {
+					throw std::out_of_range{"small_vector::at"};
+				}
+				return begin_[i];
+			}
+			T& front() noexcept {
+				STL2_ASSUME(!empty());
+				return *begin_;
+			}
+			const T& front() const noexcept {
+				STL2_ASSUME(!empty());
+				return *begin_;
+			}
+			T& back() noexcept {
+				STL2_ASSUME(!empty());
+				return end_[-1];
+			}
+			const T& back() const noexcept {
+				STL2_ASSUME(!empty());
+				return end_[-1];
+			}
+
+			void reserve(size_type n) {
+				if (n > capacity()) {
+					if (n > max_size()) {
+						throw std::length_error{"small_vector too long"};
+					}
+					reallocate(n);
+				}
+			}
+
+			// Moves the elements back inline if they fit, and otherwise to
+			// an allocation of exactly size() elements.
+			void shrink_to_fit() {
+				if (is_inline() || size() == capacity()) {
+					return;
+				}
+				if (size() <= N) {
+					T* const p = begin_;
+					auto const n = capacity();
+					T* const e = detail::uninitialized_relocate_n(
+						p, end_ - p, inline_data());
+					deallocate(p, n);
+					begin_ = inline_data();
+					end_ = e;
+					alloc_ = begin_ + N;
+				} else {
+					reallocate(size());
+				}
+			}
+
+			void clear() noexcept {
+				truncate(begin_);
+			}
+
+			template <class...Args>
+			requires Constructible<T, Args...>()
+			T& emplace_back(Args&&...args) {
+				if (end_ != alloc_) {
+					detail::construct(*end_, __stl2::forward<Args>(args)...);
+					return *end_++;
+				}
+				return emplace_back_slow(__stl2::forward<Args>(args)...);
+			}
+
+			void push_back(const T& value)
+			requires CopyConstructible<T>()
+			{
+				emplace_back(value);
+			}
+
+			void push_back(T&& value)
+			requires MoveConstructible<T>()
+			{
+				emplace_back(__stl2::move(value));
+			}
+
+			void pop_back() noexcept {
+				STL2_ASSUME(!empty());
+				detail::destruct(*--end_);
+			}
+
+			void resize(size_type n)
+			requires DefaultConstructible<T>()
+			{
+				if (n <= size()) {
+					truncate(begin_ + n);
+				} else {
+					reserve(n);
+					end_ = __stl2::uninitialized_value_construct_n(end_, n - size());
+				}
+			}
+
+			void resize(size_type n, const T& value)
+			requires CopyConstructible<T>()
+			{
+				if (n <= size()) {
+					truncate(begin_ + n);
+				} else {
+					append_n(n - size(), value);
+				}
+			}
+
+			template <class...Args>
+			requires
+				Constructible<T, Args...>() &&
+				Movable<T>()
+			iterator emplace(const_iterator pos, Args&&...args) {
+				auto const off = pos - begin_;
+				STL2_ASSUME(off >= 0 && off <= end_ - begin_);
+				if (pos == end_) {
+					emplace_back(__stl2::forward<Args>(args)...);
+					return begin_ + off;
+				}
+				// Construct first: args may refer to an element of this
+				// vector, which the shift below overwrites.
+				T tmp{__stl2::forward<Args>(args)...};
+				if (end_ == alloc_) {
+					reallocate(next_capacity(size() + 1));
+				}
+				T* const p = begin_ + off;
+				detail::construct(*end_, __stl2::move(end_[-1]));
+				++end_;
+				__stl2::move_backward(p, end_ - 2, end_ - 1);
+				*p = __stl2::move(tmp);
+				return p;
+			}
+
+			iterator insert(const_iterator pos, const T& value)
+			requires CopyConstructible<T>() && Movable<T>()
+			{
+				return emplace(pos, value);
+			}
+
+			iterator insert(const_iterator pos, T&& value)
+			requires Movable<T>()
+			{
+				return emplace(pos, __stl2::move(value));
+			}
+
+			iterator insert(const_iterator pos, size_type n, const T& value)
+			requires CopyConstructible<T>() && Movable<T>()
+			{
+				auto const off = pos - begin_;
+				auto const old_size = size();
+				append_n(n, value);
+				return rotate_into_place(off, old_size);
+			}
+
+			template <InputIterator I, Sentinel<I> S>
+			requires
+				Constructible<T, reference_t<I>>() &&
+				Movable<T>()
+			iterator insert(const_iterator pos, I first, S last) {
+				auto const off = pos - begin_;
+				auto const old_size = size();
+				append(__stl2::move(first), __stl2::move(last));
+				return rotate_into_place(off, old_size);
+			}
+
+			iterator insert(const_iterator pos, std::initializer_list<T> il)
+			requires CopyConstructible<T>() && Movable<T>()
+			{
+				return insert(pos, il.begin(), il.end());
+			}
+
+			iterator erase(const_iterator pos)
+			requires Movable<T>()
+			{
+				STL2_ASSUME(pos != end_);
+				T* const p = begin_ + (pos - begin_);
+				__stl2::move(p + 1, end_, p);
+				pop_back();
+				return p;
+			}
+
+			iterator erase(const_iterator first, const_iterator last)
+			requires Movable<T>()
+			{
+				T* const p = begin_ + (first - begin_);
+				if (first != last) {
+					truncate(__stl2::move(begin_ + (last - begin_), end_, p).out());
+				}
+				return p;
+			}
+
+			void swap(small_vector& that)
+			noexcept(detail::nothrow_relocatable<T>)
+			{
+				if (!is_inline() && !that.is_inline()) {
+					__stl2::swap(begin_, that.begin_);
+					__stl2::swap(end_, that.end_);
+					__stl2::swap(alloc_, that.alloc_);
+					return;
+				}
+				small_vector tmp(__stl2::move(that));
+				that = __stl2::move(*this);
+				*this = __stl2::move(tmp);
+			}
+
+			friend void swap(small_vector& x, small_vector& y)
+			noexcept(noexcept(x.swap(y)))
+			{
+				x.swap(y);
+			}
+		};
+
+		template <EqualityComparable T, std::size_t N>
+		bool operator==(const small_vector<T, N>& x, const small_vector<T, N>& y) {
+			return __stl2::equal(x, y);
+		}
+
+		template <EqualityComparable T, std::size_t N>
+		bool operator!=(const small_vector<T, N>& x, const small_vector<T, N>& y) {
+			return !(x == y);
+		}
+
+		template <StrictTotallyOrdered T, std::size_t N>
+		bool operator<(const small_vector<T, N>& x, const small_vector<T, N>& y) {
+			return __stl2::lexicographical_compare(x, y);
+		}
+
+		template <StrictTotallyOrdered T, std::size_t N>
+		bool operator>(const small_vector<T, N>& x, const small_vector<T, N>& y) {
+			return y < x;
+		}
+
+		template <StrictTotallyOrdered T, std::size_t N>
+		bool operator<=(const small_vector<T, N>& x, const small_vector<T, N>& y) {
+			return !(y < x);
+		}
+
+		template <StrictTotallyOrdered T, std::size_t N>
+		bool operator>=(const small_vector<T, N>& x, const small_vector<T, N>& y) {
+			return !(x < y);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
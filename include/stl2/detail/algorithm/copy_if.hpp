@@ -16,7 +16,9 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/utility.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/temporary_vector.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -73,6 +75,121 @@ STL2_OPEN_NAMESPACE {
 		return __stl2::copy_if(rng, __stl2::forward<O>(result),
 			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
 	}
+
+	namespace detail {
+		// Copies first[i] for each i in [0, n) such that keep(i) to result,
+		// preserving order, using k chunks. Three passes: each chunk counts
+		// (and remembers) its selected elements, a prefix scan of the counts
+		// yields each chunk's offset in the output, and each chunk then copies
+		// its elements to its own disjoint slice of the output.
+		template <RandomAccessIterator I, RandomAccessIterator O, class Keep>
+		O parallel_copy_if_index(std::ptrdiff_t k, I first, std::ptrdiff_t n,
+			O result, Keep& keep)
+		{
+			// Remember the selection if there's room; otherwise it is
+			// recomputed in the scatter pass.
+			detail::temporary_buffer<bool> buf{n};
+			bool* const flags = buf.size() >= n ? buf.data() : nullptr;
+
+			auto offsets = std::make_unique<std::ptrdiff_t[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const lo = detail::chunk_offset(n, k, c);
+				auto const hi = detail::chunk_offset(n, k, c + 1);
+				std::ptrdiff_t count = 0;
+				for (auto i = lo; i < hi; ++i) {
+					bool const b = keep(i);
+					if (flags) {
+						flags[i] = b;
+					}
+					count += b;
+				}
+				offsets[c] = count;
+			});
+			auto const total = detail::exclusive_scan_counts(offsets.get(), k);
+
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const lo = detail::chunk_offset(n, k, c);
+				auto const hi = detail::chunk_offset(n, k, c + 1);
+				auto out = result + static_cast<difference_type_t<O>>(offsets[c]);
+				for (auto i = lo; i < hi; ++i) {
+					if (flags ? flags[i] : keep(i)) {
+						*out = first[i];
+						++out;
+					}
+				}
+			});
+
+			return result + static_cast<difference_type_t<O>>(total);
+		}
+	}
+
+	namespace __copy_if {
+		template <class EP, class I, class S, class O, class Pred, class Proj>
+		tagged_pair<tag::in(I), tag::out(O)>
+		par(false_type, const EP&, I first, S last, O result,
+			Pred& pred, Proj& proj)
+		{
+			return __stl2::copy_if(__stl2::move(first), __stl2::move(last),
+				__stl2::move(result), __stl2::ref(pred), __stl2::ref(proj));
+		}
+
+		template <class EP, class I, class S, class O, class Pred, class Proj>
+		tagged_pair<tag::in(I), tag::out(O)>
+		par(true_type, const EP& pol, I first, S last, O result,
+			Pred& pred, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __copy_if::par(false_type{}, pol, __stl2::move(first),
+					__stl2::move(last), __stl2::move(result), pred, proj);
+			}
+			auto keep = [&](std::ptrdiff_t i) -> bool {
+				return pred(proj(first[i]));
+			};
+			result = detail::parallel_copy_if_index(k, first, n,
+				__stl2::move(result), keep);
+			return {first + n, __stl2::move(result)};
+		}
+	}
+
+	// Extension
+	template <class EP, InputIterator I, Sentinel<I> S, WeaklyIncrementable O,
+		class Pred, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectlyCopyable<I, O> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<I, __f<Proj>>>
+	tagged_pair<tag::in(I), tag::out(O)>
+	copy_if(EP&& pol, I first, S last, O result, Pred&& pred_,
+		Proj&& proj_ = Proj{})
+	{
+		auto pred = ext::make_callable_wrapper(__stl2::forward<Pred>(pred_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __copy_if::par(
+			meta::bool_<detail::parallel_iterator<I, S> &&
+				models::RandomAccessIterator<O>>{},
+			pol, __stl2::move(first), __stl2::move(last), __stl2::move(result),
+			pred, proj);
+	}
+
+	// Extension
+	template <class EP, InputRange Rng, class O, class Pred, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::WeaklyIncrementable<__f<O>> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<iterator_t<Rng>, __f<Proj>>> &&
+		models::IndirectlyCopyable<iterator_t<Rng>, __f<O>>
+	tagged_pair<tag::in(safe_iterator_t<Rng>), tag::out(__f<O>)>
+	copy_if(EP&& pol, Rng&& rng, O&& result, Pred&& pred, Proj&& proj = Proj{})
+	{
+		return __stl2::copy_if(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			__stl2::forward<O>(result), __stl2::forward<Pred>(pred),
+			__stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
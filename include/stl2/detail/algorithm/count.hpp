@@ -16,6 +16,8 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/simd.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // count [alg.count]
@@ -60,6 +62,84 @@ STL2_OPEN_NAMESPACE {
 	{
 		return __stl2::count(rng, value, __stl2::forward<Proj>(proj));
 	}
+
+	namespace __count {
+		template <class I, class T, class Proj>
+		std::ptrdiff_t chunk(false_type, I first, std::ptrdiff_t n,
+			const T& value, Proj& proj)
+		{
+			std::ptrdiff_t result = 0;
+			for (std::ptrdiff_t i = 0; i < n; ++i) {
+				result += static_cast<bool>(proj(first[i]) == value);
+			}
+			return result;
+		}
+
+		template <class I, class T, class Proj>
+		std::ptrdiff_t chunk(true_type, I first, std::ptrdiff_t n,
+			const T& value, Proj&)
+		{
+			return n > 0 ? detail::simd::count(detail::simd_data(first), n, value) : 0;
+		}
+
+		template <class Fast, class EP, class I, class S, class T, class Proj>
+		difference_type_t<I>
+		par(false_type, Fast, const EP&, I first, S last, const T& value, Proj& proj)
+		{
+			return __stl2::count(__stl2::move(first), __stl2::move(last), value,
+				__stl2::ref(proj));
+		}
+
+		template <class Fast, class EP, class I, class S, class T, class Proj>
+		difference_type_t<I>
+		par(true_type, Fast, const EP& pol, I first, S last, const T& value, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __count::chunk(Fast{}, first, n, value, proj);
+			}
+			auto counts = std::make_unique<std::ptrdiff_t[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const lo = detail::chunk_offset(n, k, c);
+				auto const hi = detail::chunk_offset(n, k, c + 1);
+				counts[c] = __count::chunk(Fast{}, first + lo, hi - lo, value, proj);
+			});
+			return detail::exclusive_scan_counts(counts.get(), k);
+		}
+	}
+
+	// Extension
+	template <class EP, InputIterator I, Sentinel<I> S, class T, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableRelation<
+			equal_to<>, projected<I, __f<Proj>>, const T*>
+	difference_type_t<I>
+	count(EP&& pol, I first, S last, const T& value, Proj&& proj_ = Proj{})
+	{
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __count::par(
+			meta::bool_<detail::parallel_iterator<I, S>>{},
+			meta::bool_<detail::simd_range<I, S> &&
+				models::Same<value_type_t<I>, T> &&
+				models::Same<decay_t<Proj>, identity>>{},
+			pol, __stl2::move(first), __stl2::move(last), value, proj);
+	}
+
+	// Extension
+	template <class EP, InputRange Rng, class T, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableRelation<
+			equal_to<>, projected<iterator_t<Rng>, __f<Proj>>, const T*>
+	difference_type_t<iterator_t<Rng>>
+	count(EP&& pol, Rng&& rng, const T& value, Proj&& proj = Proj{})
+	{
+		return __stl2::count(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			value, __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
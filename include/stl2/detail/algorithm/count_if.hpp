@@ -16,6 +16,7 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // count_if [alg.count]
@@ -56,6 +57,75 @@ STL2_OPEN_NAMESPACE {
 	{
 		return __stl2::count_if(rng, __stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
 	}
+
+	namespace __count_if {
+		template <class EP, class I, class S, class Pred, class Proj>
+		difference_type_t<I>
+		par(false_type, const EP&, I first, S last, Pred& pred, Proj& proj)
+		{
+			return __stl2::count_if(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(pred), __stl2::ref(proj));
+		}
+
+		// Chunks are counted without a branch per element so that simple
+		// predicates on contiguous arithmetic data vectorize.
+		template <class I, class Pred, class Proj>
+		std::ptrdiff_t chunk(I first, std::ptrdiff_t n, Pred& pred, Proj& proj)
+		{
+			std::ptrdiff_t result = 0;
+			for (std::ptrdiff_t i = 0; i < n; ++i) {
+				result += static_cast<bool>(pred(proj(first[i])));
+			}
+			return result;
+		}
+
+		template <class EP, class I, class S, class Pred, class Proj>
+		difference_type_t<I>
+		par(true_type, const EP& pol, I first, S last, Pred& pred, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __count_if::chunk(first, n, pred, proj);
+			}
+			auto counts = std::make_unique<std::ptrdiff_t[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const lo = detail::chunk_offset(n, k, c);
+				auto const hi = detail::chunk_offset(n, k, c + 1);
+				counts[c] = __count_if::chunk(first + lo, hi - lo, pred, proj);
+			});
+			return detail::exclusive_scan_counts(counts.get(), k);
+		}
+	}
+
+	// Extension
+	template <class EP, InputIterator I, Sentinel<I> S, class Pred, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<I, __f<Proj>>>
+	difference_type_t<I>
+	count_if(EP&& pol, I first, S last, Pred&& pred_, Proj&& proj_ = Proj{})
+	{
+		auto pred = ext::make_callable_wrapper(__stl2::forward<Pred>(pred_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __count_if::par(meta::bool_<detail::parallel_iterator<I, S>>{},
+			pol, __stl2::move(first), __stl2::move(last), pred, proj);
+	}
+
+	// Extension
+	template <class EP, InputRange Rng, class Pred, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<iterator_t<Rng>, __f<Proj>>>
+	difference_type_t<iterator_t<Rng>>
+	count_if(EP&& pol, Rng&& rng, Pred&& pred, Proj&& proj = Proj{})
+	{
+		return __stl2::count_if(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -0,0 +1,72 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_DISTINCT_HPP
+#define STL2_DETAIL_ALGORITHM_DISTINCT_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/container/flat_hash_set.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash_value.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// distinct [Extension]
+// Like unique, but removes every element whose projection equals that of
+// an earlier element, not only adjacent ones, so the input need not be
+// sorted. The first occurrence of each value is kept, in order. Expected
+// linear time; the distinct projected values are copied into a hash table.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template <ForwardIterator I, Sentinel<I> S, class Proj = identity>
+		requires
+			models::Permutable<I> &&
+			models::IndirectlyHashable<I, __f<Proj>>
+		I distinct(I first, S last, Proj&& proj_ = Proj{})
+		{
+			auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+			using V = decay_t<reference_t<projected<I, decltype(proj)>>>;
+			flat_hash_set<V, hasher, equal_to<>> seen;
+			// Skip the leading run that is already distinct, so that nothing
+			// is moved onto itself.
+			for (; first != last; ++first) {
+				if (!seen.insert(proj(*first)).second) {
+					break;
+				}
+			}
+			if (first != last) {
+				for (auto m = __stl2::next(first); m != last; ++m) {
+					if (seen.insert(proj(*m)).second) {
+						*first = __stl2::iter_move(m);
+						++first;
+					}
+				}
+			}
+			return first;
+		}
+
+		template <ForwardRange Rng, class Proj = identity>
+		requires
+			models::Permutable<iterator_t<Rng>> &&
+			models::IndirectlyHashable<iterator_t<Rng>, __f<Proj>>
+		safe_iterator_t<Rng>
+		distinct(Rng&& rng, Proj&& proj = Proj{})
+		{
+			return ext::distinct(__stl2::begin(rng), __stl2::end(rng),
+				__stl2::forward<Proj>(proj));
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
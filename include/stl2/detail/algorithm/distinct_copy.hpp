@@ -0,0 +1,80 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_DISTINCT_COPY_HPP
+#define STL2_DETAIL_ALGORITHM_DISTINCT_COPY_HPP
+
+#include <initializer_list>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/container/flat_hash_set.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash_value.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// distinct_copy [Extension]
+// Copies the first occurrence of each projected value in [first, last) to
+// result, in order. The input need not be sorted.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template <InputIterator I, Sentinel<I> S, WeaklyIncrementable O,
+			class Proj = identity>
+		requires
+			models::IndirectlyCopyable<I, O> &&
+			models::IndirectlyHashable<I, __f<Proj>>
+		tagged_pair<tag::in(I), tag::out(O)>
+		distinct_copy(I first, S last, O result, Proj&& proj_ = Proj{})
+		{
+			auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+			using V = decay_t<reference_t<projected<I, decltype(proj)>>>;
+			flat_hash_set<V, hasher, equal_to<>> seen;
+			for (; first != last; ++first) {
+				reference_t<I>&& v = *first;
+				if (seen.insert(proj(v)).second) {
+					*result = __stl2::forward<reference_t<I>>(v);
+					++result;
+				}
+			}
+			return {__stl2::move(first), __stl2::move(result)};
+		}
+
+		template <InputRange Rng, class O, class Proj = identity>
+		requires
+			models::WeaklyIncrementable<__f<O>> &&
+			models::IndirectlyCopyable<iterator_t<Rng>, __f<O>> &&
+			models::IndirectlyHashable<iterator_t<Rng>, __f<Proj>>
+		tagged_pair<tag::in(safe_iterator_t<Rng>), tag::out(__f<O>)>
+		distinct_copy(Rng&& rng, O&& result, Proj&& proj = Proj{})
+		{
+			return ext::distinct_copy(__stl2::begin(rng), __stl2::end(rng),
+				__stl2::forward<O>(result), __stl2::forward<Proj>(proj));
+		}
+
+		// Extension
+		template <class E, class O, class Proj = identity>
+		requires
+			models::WeaklyIncrementable<__f<O>> &&
+			models::IndirectlyCopyable<const E*, __f<O>> &&
+			models::IndirectlyHashable<const E*, __f<Proj>>
+		tagged_pair<tag::in(dangling<const E*>), tag::out(__f<O>)>
+		distinct_copy(std::initializer_list<E>&& rng, O&& result,
+			Proj&& proj = Proj{})
+		{
+			return ext::distinct_copy(__stl2::begin(rng), __stl2::end(rng),
+				__stl2::forward<O>(result), __stl2::forward<Proj>(proj));
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,415 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_GENERATE_RANDOM_HPP
+#define STL2_DETAIL_ALGORITHM_GENERATE_RANDOM_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stl2/iterator.hpp>
+#include <stl2/random.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/bounded_rand.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/random_engine.hpp>
+#include <stl2/detail/randutils.hpp>
+#include <stl2/detail/simd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// generate_random [Extension]
+// Assigns dist(gen) to each element of [first, last), or something with the
+// same distribution, in bulk where possible.
+//
+// For contiguous ranges of arithmetic values, a generator uniform over all
+// 32 or 64 bits, and a uniform_int_distribution, uniform_real_distribution
+// or normal_distribution of the element type, the values come from sixteen
+// xoshiro256++ streams seeded from gen, stepped side by side in loops the
+// compiler can vectorize, and are transformed a block at a time:
+// * integers by Lemire's multiply-shift, 32 bits at a time when the range
+//   allows;
+// * reals by filling the mantissa of a double in [1, 2) (or two floats)
+//   and subtracting 1;
+// * normals by the ziggurat method, whose fast path is branch-free.
+// The rare values that need rejection are redrawn afterwards by a scalar
+// stream. The results are thus not those that repeated calls to dist(gen)
+// would produce, and gen advances by only a few draws.
+//
+// Everything else is a plain loop of dist(gen).
+//
+STL2_OPEN_NAMESPACE {
+	namespace __generate_random {
+		// Sixteen lanes are enough to fill the vector units without
+		// tempting the compiler to unroll the lane loop into scalars.
+		constexpr std::size_t lanes = 16;
+		constexpr std::size_t block = 256;
+
+		// xoshiro256++ in lanes independent streams, state-interleaved.
+		class lane_engine {
+			std::uint64_t s0_[lanes], s1_[lanes], s2_[lanes], s3_[lanes];
+
+		public:
+			template <class G>
+			explicit lane_engine(G& g) {
+				for (std::size_t l = 0; l < lanes; ++l) {
+					ext::splitmix64 sm{detail::random_bits64(g)};
+					s0_[l] = sm();
+					s1_[l] = sm();
+					s2_[l] = sm();
+					s3_[l] = sm();
+				}
+			}
+
+			// Fills out[0, block).
+			void fill(std::uint64_t* out) noexcept {
+				for (std::size_t r = 0; r < block; r += lanes) {
+					for (std::size_t l = 0; l < lanes; ++l) {
+						out[r + l] = detail::rotl64(s0_[l] + s3_[l], 23) + s0_[l];
+						auto const t = s1_[l] << 17;
+						s2_[l] ^= s0_[l];
+						s3_[l] ^= s1_[l];
+						s1_[l] ^= s2_[l];
+						s0_[l] ^= s3_[l];
+						s2_[l] ^= t;
+						s3_[l] = detail::rotl64(s3_[l], 45);
+					}
+				}
+			}
+		};
+
+		template <class To, class From>
+		To bit_cast(const From& from) noexcept {
+			static_assert(sizeof(To) == sizeof(From), "");
+			To to;
+			std::memcpy(&to, &from, sizeof(To));
+			return to;
+		}
+
+		// Uniform in [0, 1) with 52 random bits.
+		inline double unit(std::uint64_t w) noexcept {
+			return __generate_random::bit_cast<double>(
+				(w >> 12) | 0x3ff0000000000000ull) - 1.0;
+		}
+
+		// Uniform in [0, 1) with 23 random bits.
+		inline float unit(std::uint32_t w) noexcept {
+			return __generate_random::bit_cast<float>(
+				(w >> 9) | 0x3f800000u) - 1.0f;
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		// Kernels
+		// Each fills p[0, n) from words[0, n) (or from fewer words, for
+		// types narrower than 32 bits), and redraws what needs rejection
+		// from fix.
+		//
+		template <class T, class Fix>
+		requires is_integral<T>::value
+		void kernel(T* p, std::size_t n, const std::uint64_t* words,
+			const std::uniform_int_distribution<T>& dist, Fix& fix)
+		{
+			using U = make_unsigned_t<T>;
+			auto const lo = static_cast<std::uint64_t>(static_cast<U>(dist.a()));
+			auto const range = static_cast<std::uint64_t>(static_cast<U>(
+				static_cast<U>(dist.b()) - static_cast<U>(dist.a()))) + 1;
+			auto const value = [lo](std::uint64_t offset) {
+				return static_cast<T>(static_cast<U>(lo + offset));
+			};
+			if (range == 0) {
+				// All 2^64 values.
+				for (std::size_t i = 0; i < n; ++i) {
+					p[i] = value(words[i]);
+				}
+			} else if (range <= (std::uint64_t{1} << 32)) {
+				auto const threshold = static_cast<std::uint32_t>(
+					((std::uint64_t{1} << 32) - range) % range);
+				std::uint32_t halves[2 * block];
+				std::memcpy(halves, words, sizeof(halves));
+				bool reject = false;
+				for (std::size_t i = 0; i < n; ++i) {
+					auto const m = std::uint64_t{halves[i]} * range;
+					p[i] = value(m >> 32);
+					reject |= static_cast<std::uint32_t>(m) < threshold;
+				}
+				if (reject) {
+					for (std::size_t i = 0; i < n; ++i) {
+						auto const m = std::uint64_t{halves[i]} * range;
+						if (static_cast<std::uint32_t>(m) < threshold) {
+							p[i] = value(detail::bounded_rand(true_type{}, fix, range));
+						}
+					}
+				}
+			} else {
+				auto const threshold = (0 - range) % range;
+				bool reject = false;
+				for (std::size_t i = 0; i < n; ++i) {
+					std::uint64_t m;
+					p[i] = value(detail::mul_hi64(words[i], range, m));
+					reject |= m < threshold;
+				}
+				if (reject) {
+					for (std::size_t i = 0; i < n; ++i) {
+						std::uint64_t m;
+						detail::mul_hi64(words[i], range, m);
+						if (m < threshold) {
+							p[i] = value(detail::bounded_rand(true_type{}, fix, range));
+						}
+					}
+				}
+			}
+		}
+
+		template <class Fix>
+		void kernel(double* p, std::size_t n, const std::uint64_t* words,
+			const std::uniform_real_distribution<double>& dist, Fix&)
+		{
+			auto const a = dist.a();
+			auto const scale = dist.b() - dist.a();
+			for (std::size_t i = 0; i < n; ++i) {
+				p[i] = a + __generate_random::unit(words[i]) * scale;
+			}
+		}
+
+		template <class Fix>
+		void kernel(float* p, std::size_t n, const std::uint64_t* words,
+			const std::uniform_real_distribution<float>& dist, Fix&)
+		{
+			auto const a = dist.a();
+			auto const scale = dist.b() - dist.a();
+			std::uint32_t halves[2 * block];
+			std::memcpy(halves, words, sizeof(halves));
+			for (std::size_t i = 0; i < n; ++i) {
+				p[i] = a + __generate_random::unit(halves[i]) * scale;
+			}
+		}
+
+		// Doornik's ZIGNOR ("An Improved Ziggurat Method to Generate Normal
+		// Random Samples", 2005): 128 strips of equal area under the
+		// normal density, x[i] their right edges and ratio[i] = x[i+1] / x[i].
+		struct ziggurat {
+			static constexpr int strips = 128;
+			static constexpr double r = 3.442619855899;
+			static constexpr double v = 9.91256303526217e-3;
+
+			double x[strips + 1];
+			double ratio[strips];
+
+			ziggurat() noexcept {
+				auto f = std::exp(-0.5 * r * r);
+				x[0] = v / f;
+				x[1] = r;
+				x[strips] = 0;
+				for (int i = 2; i < strips; ++i) {
+					x[i] = std::sqrt(-2 * std::log(v / x[i - 1] + f));
+					f = std::exp(-0.5 * x[i] * x[i]);
+				}
+				for (int i = 0; i < strips; ++i) {
+					ratio[i] = x[i + 1] / x[i];
+				}
+			}
+
+			static const ziggurat& get() noexcept {
+				static const ziggurat z;
+				return z;
+			}
+
+			// Completes a draw whose fast path, with strip i and u in
+			// (-1, 1), failed.
+			template <class G>
+			double slow(int i, double u, G& g) const {
+				auto unit = [&g] {
+					return __generate_random::unit(detail::random_bits64(g));
+				};
+				while (true) {
+					if (i == 0) {
+						// The tail beyond r, by Marsaglia's method.
+						double t, y;
+						do {
+							t = std::log1p(-unit()) / r;
+							y = std::log1p(-unit());
+						} while (-2 * y < t * t);
+						return u < 0 ? t - r : r - t;
+					}
+					auto const z = u * x[i];
+					auto const f0 = std::exp(-0.5 * (x[i] * x[i] - z * z));
+					auto const f1 = std::exp(-0.5 * (x[i + 1] * x[i + 1] - z * z));
+					if (f1 + unit() * (f0 - f1) < 1.0) {
+						return z;
+					}
+					auto const w = detail::random_bits64(g);
+					i = static_cast<int>(w & (strips - 1));
+					u = 2 * __generate_random::unit(w) - 1;
+					if (std::fabs(u) < ratio[i]) {
+						return u * x[i];
+					}
+				}
+			}
+		};
+
+		// The strip comes from the low 7 bits of a word and u from its top
+		// 52, so the two are independent.
+		template <class T, class Fix>
+		requires is_floating_point<T>::value
+		void kernel(T* p, std::size_t n, const std::uint64_t* words,
+			const std::normal_distribution<T>& dist, Fix& fix)
+		{
+			auto const& z = ziggurat::get();
+			auto const mean = static_cast<double>(dist.mean());
+			auto const sigma = static_cast<double>(dist.stddev());
+			bool reject = false;
+			for (std::size_t i = 0; i < n; ++i) {
+				auto const s = static_cast<int>(words[i] & (ziggurat::strips - 1));
+				auto const u = 2 * __generate_random::unit(words[i]) - 1;
+				p[i] = static_cast<T>(mean + sigma * (u * z.x[s]));
+				reject |= !(std::fabs(u) < z.ratio[s]);
+			}
+			if (reject) {
+				for (std::size_t i = 0; i < n; ++i) {
+					auto const s = static_cast<int>(words[i] & (ziggurat::strips - 1));
+					auto const u = 2 * __generate_random::unit(words[i]) - 1;
+					if (!(std::fabs(u) < z.ratio[s])) {
+						p[i] = static_cast<T>(mean + sigma * z.slow(s, u, fix));
+					}
+				}
+			}
+		}
+
+		// Distributions with a kernel for element type T.
+		template <class Dist, class T>
+		constexpr bool bulk = false;
+		template <class T>
+		requires is_integral<T>::value && !models::Same<T, bool>
+		constexpr bool bulk<std::uniform_int_distribution<T>, T> = true;
+		template <>
+		constexpr bool bulk<std::uniform_real_distribution<double>, double> = true;
+		template <>
+		constexpr bool bulk<std::uniform_real_distribution<float>, float> = true;
+		template <>
+		constexpr bool bulk<std::normal_distribution<double>, double> = true;
+		template <>
+		constexpr bool bulk<std::normal_distribution<float>, float> = true;
+
+		template <class O, class S, class Dist, class Gen>
+		O loop(O first, S last, Dist& dist, Gen& gen)
+		{
+			for (; first != last; ++first) {
+				*first = dist(gen);
+			}
+			return first;
+		}
+
+		template <class T, class Dist, class Gen>
+		void fill(T* p, std::size_t n, Dist& dist, Gen& gen)
+		{
+			// Small ranges are not worth seeding the lanes for.
+			if (n < block) {
+				__generate_random::loop(p, p + n, dist, gen);
+				return;
+			}
+			lane_engine lanes{gen};
+			ext::xoshiro256pp fix{detail::random_bits64(gen)};
+			// Types of up to 32 bits take half a word per element, except
+			// that the normal kernel uses a whole word.
+			constexpr std::size_t chunk = sizeof(T) <= 4 &&
+				!is_same<Dist, std::normal_distribution<T>>::value
+				? 2 * block : block;
+			alignas(64) std::uint64_t words[block];
+			for (; n > 0; ) {
+				auto const m = n < chunk ? n : chunk;
+				lanes.fill(words);
+				__generate_random::kernel(p, m, words, dist, fix);
+				p += m;
+				n -= m;
+			}
+		}
+
+		template <class I, class S, class Dist, class Gen>
+		I impl(false_type, I first, S last, Dist& dist, Gen& gen)
+		{
+			return __generate_random::loop(__stl2::move(first), __stl2::move(last),
+				dist, gen);
+		}
+
+		template <class I, class S, class Dist, class Gen>
+		I impl(true_type, I first, S last, Dist& dist, Gen& gen)
+		{
+			auto const n = last - first;
+			if (n > 0) {
+				__generate_random::fill(detail::simd_data(first),
+					static_cast<std::size_t>(n), dist, gen);
+			}
+			return first + n;
+		}
+
+		template <class Rng, class Dist, class Gen>
+		iterator_t<Rng> range(false_type, Rng& rng, Dist& dist, Gen& gen)
+		{
+			return __generate_random::loop(__stl2::begin(rng), __stl2::end(rng),
+				dist, gen);
+		}
+
+		template <class Rng, class Dist, class Gen>
+		iterator_t<Rng> range(true_type, Rng& rng, Dist& dist, Gen& gen)
+		{
+			auto const n = __stl2::size(rng);
+			if (n > 0) {
+				__generate_random::fill(__stl2::data(rng),
+					static_cast<std::size_t>(n), dist, gen);
+			}
+			return __stl2::begin(rng) +
+				static_cast<difference_type_t<iterator_t<Rng>>>(n);
+		}
+
+		template <class T, class Dist, class Gen>
+		constexpr bool fast =
+			bulk<Dist, T> && detail::full_width_urng<Gen>;
+	}
+
+	namespace ext {
+		template <Iterator O, Sentinel<O> S, class Dist,
+			class Gen = detail::default_random_engine&>
+		requires
+			models::UniformRandomNumberGenerator<remove_reference_t<Gen>> &&
+			models::Writable<O, result_of_t<Dist&(remove_reference_t<Gen>&)>>
+		O generate_random(O first, S last, Dist& dist,
+			Gen&& gen = detail::get_random_engine())
+		{
+			return __generate_random::impl(
+				meta::bool_<detail::simd_range<O, S> &&
+					__generate_random::fast<value_type_t<O>, Dist,
+						remove_reference_t<Gen>>>{},
+				__stl2::move(first), __stl2::move(last), dist, gen);
+		}
+
+		template <Range Rng, class Dist,
+			class Gen = detail::default_random_engine&>
+		requires
+			models::UniformRandomNumberGenerator<remove_reference_t<Gen>> &&
+			models::Writable<iterator_t<Rng>,
+				result_of_t<Dist&(remove_reference_t<Gen>&)>>
+		safe_iterator_t<Rng> generate_random(Rng&& rng, Dist& dist,
+			Gen&& gen = detail::get_random_engine())
+		{
+			return __generate_random::range(
+				meta::bool_<models::SizedRange<Rng> &&
+					ext::__contiguous_range<remove_reference_t<Rng>> &&
+					__generate_random::fast<value_type_t<iterator_t<Rng>>, Dist,
+						remove_reference_t<Gen>>>{},
+				rng, dist, gen);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
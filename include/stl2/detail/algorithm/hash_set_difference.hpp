@@ -0,0 +1,94 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_HASH_SET_DIFFERENCE_HPP
+#define STL2_DETAIL_ALGORITHM_HASH_SET_DIFFERENCE_HPP
+
+#include <cstddef>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/container/flat_hash_map.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash_value.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// hash_set_difference [Extension]
+// Copies to result, in order, the elements of [first1, last1) whose
+// projections are not matched by elements of [first2, last2): an element
+// whose value occurs m times in the first range and n times in the second
+// is copied for all but its first min(m, n) occurrences, the same number
+// set_difference would copy. The inputs need not be sorted. Expected
+// linear time; the distinct values of the second range are counted in a
+// hash table.
+//
+// Both ranges must project to the same value type, so that equal values
+// hash equally.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template <InputIterator I1, Sentinel<I1> S1,
+			InputIterator I2, Sentinel<I2> S2,
+			WeaklyIncrementable O, class Proj1 = identity, class Proj2 = identity>
+		requires
+			models::IndirectlyCopyable<I1, O> &&
+			models::IndirectlyHashable<I2, __f<Proj2>> &&
+			models::IndirectRegularCallable<__f<Proj1>, I1> &&
+			models::Same<
+				decay_t<reference_t<projected<I1, __f<Proj1>>>>,
+				decay_t<reference_t<projected<I2, __f<Proj2>>>>>
+		O hash_set_difference(I1 first1, S1 last1, I2 first2, S2 last2, O result,
+			Proj1&& proj1_ = Proj1{}, Proj2&& proj2_ = Proj2{})
+		{
+			auto proj1 = ext::make_callable_wrapper(__stl2::forward<Proj1>(proj1_));
+			auto proj2 = ext::make_callable_wrapper(__stl2::forward<Proj2>(proj2_));
+			using V = decay_t<reference_t<projected<I2, decltype(proj2)>>>;
+			flat_hash_map<V, std::ptrdiff_t, hasher, equal_to<>> counts;
+			for (; first2 != last2; ++first2) {
+				++counts.try_emplace(proj2(*first2), 0).first->second;
+			}
+			for (; first1 != last1; ++first1) {
+				reference_t<I1>&& v = *first1;
+				auto i = counts.find(proj1(v));
+				if (i != counts.end() && i->second > 0) {
+					--i->second;
+				} else {
+					*result = __stl2::forward<reference_t<I1>>(v);
+					++result;
+				}
+			}
+			return result;
+		}
+
+		template <InputRange Rng1, InputRange Rng2, class O,
+			class Proj1 = identity, class Proj2 = identity>
+		requires
+			models::WeaklyIncrementable<__f<O>> &&
+			models::IndirectlyCopyable<iterator_t<Rng1>, __f<O>> &&
+			models::IndirectlyHashable<iterator_t<Rng2>, __f<Proj2>> &&
+			models::IndirectRegularCallable<__f<Proj1>, iterator_t<Rng1>> &&
+			models::Same<
+				decay_t<reference_t<projected<iterator_t<Rng1>, __f<Proj1>>>>,
+				decay_t<reference_t<projected<iterator_t<Rng2>, __f<Proj2>>>>>
+		__f<O> hash_set_difference(Rng1&& rng1, Rng2&& rng2, O&& result,
+			Proj1&& proj1 = Proj1{}, Proj2&& proj2 = Proj2{})
+		{
+			return ext::hash_set_difference(
+				__stl2::begin(rng1), __stl2::end(rng1),
+				__stl2::begin(rng2), __stl2::end(rng2),
+				__stl2::forward<O>(result), __stl2::forward<Proj1>(proj1),
+				__stl2::forward<Proj2>(proj2));
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
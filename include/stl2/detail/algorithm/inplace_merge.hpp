@@ -26,6 +26,7 @@
 #include <stl2/iterator.hpp>
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/temporary_vector.hpp>
 #include <stl2/detail/algorithm/move.hpp>
 #include <stl2/detail/algorithm/merge.hpp>
@@ -33,7 +34,6 @@
 #include <stl2/detail/algorithm/upper_bound.hpp>
 #include <stl2/detail/algorithm/rotate.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
-#include <algorithm>
 
 ///////////////////////////////////////////////////////////////////////////
 // inplace_merge [alg.merge]
@@ -46,37 +46,63 @@ STL2_OPEN_NAMESPACE {
 	namespace detail {
 		struct merge_adaptive_fn {
 		private:
+			// Merges the buffered run [bfirst, blast) with the run
+			// [first, last) that ends where the output does, taking the
+			// element in place only when pred orders it strictly first. The
+			// output never overtakes first, and once the buffer is drained the
+			// rest of [first, last) is already where it belongs, so nothing is
+			// ever moved onto itself.
+			template <class B, class I, class C, class P>
+			static void half_merge(B bfirst, B blast, I first, I last, I out,
+				C& pred, P& proj)
+			{
+				for (; bfirst != blast; ++out) {
+					if (first == last) {
+						__stl2::move(__stl2::move(bfirst), __stl2::move(blast),
+							__stl2::move(out));
+						return;
+					}
+					if (pred(proj(*first), proj(*bfirst))) {
+						*out = __stl2::iter_move(first);
+						++first;
+					} else {
+						*out = __stl2::iter_move(bfirst);
+						++bfirst;
+					}
+				}
+			}
+
 			template <BidirectionalIterator I, class C, class P>
 			requires
 				models::Sortable<I, C, P>
 			static void impl(I begin, I middle, I end, difference_type_t<I> len1,
-				difference_type_t<I> len2, temporary_buffer<value_type_t<I>>& buf,
+				difference_type_t<I> len2, scratch_vector<value_type_t<I>>& vec,
 				C& pred, P& proj)
 			{
 				STL2_EXPENSIVE_ASSERT(len1 == __stl2::distance(begin, midddle));
 				STL2_EXPENSIVE_ASSERT(len2 == __stl2::distance(middle, end));
-				temporary_vector<value_type_t<I>> vec{buf};
+				STL2_ASSUME(vec.empty());
+				// The buffered run goes back into place ahead of equivalent
+				// elements of the run left in place, so that elements of
+				// [begin, middle) stay ahead of equivalent elements of
+				// [middle, end).
 				if (len1 <= len2) {
 					__stl2::move(begin, middle, __stl2::back_inserter(vec));
-					__stl2::merge(
-						__stl2::make_move_iterator(__stl2::begin(vec)),
-						__stl2::make_move_iterator(__stl2::end(vec)),
-						__stl2::make_move_iterator(__stl2::move(middle)),
-						__stl2::make_move_iterator(__stl2::move(end)),
-						__stl2::move(begin), __stl2::ref(pred),
-						__stl2::ref(proj), __stl2::ref(proj));
+					half_merge(__stl2::begin(vec), __stl2::end(vec),
+						__stl2::move(middle), __stl2::move(end), __stl2::move(begin),
+						pred, proj);
 				} else {
 					__stl2::move(middle, end, __stl2::back_inserter(vec));
 					using RBi = __stl2::reverse_iterator<I>;
-					__stl2::merge(
-						__stl2::make_move_iterator(RBi{__stl2::move(middle)}),
-						__stl2::make_move_iterator(RBi{__stl2::move(begin)}),
-						__stl2::make_move_iterator(__stl2::rbegin(vec)),
-						__stl2::make_move_iterator(__stl2::rend(vec)),
-						RBi{__stl2::move(end)},
-						__stl2::not_fn(__stl2::ref(pred)),
-						__stl2::ref(proj), __stl2::ref(proj));
+					auto greater = [&pred](auto&& x, auto&& y) {
+						return pred(__stl2::forward<decltype(y)>(y),
+							__stl2::forward<decltype(x)>(x));
+					};
+					half_merge(__stl2::rbegin(vec), __stl2::rend(vec),
+						RBi{__stl2::move(middle)}, RBi{__stl2::move(begin)},
+						RBi{__stl2::move(end)}, greater, proj);
 				}
+				vec.clear();
 			}
 
 		public:
@@ -84,7 +110,7 @@ STL2_OPEN_NAMESPACE {
 			requires
 				models::Sortable<I, __f<C>, __f<P>>
 			void operator()(I begin, I middle, I end, difference_type_t<I> len1, difference_type_t<I> len2,
-				detail::temporary_buffer<value_type_t<I>>& buf, C&& pred_, P&& proj_) const
+				detail::scratch_vector<value_type_t<I>>& buf, C&& pred_, P&& proj_) const
 			{
 				// Pre: len1 == distance(begin, midddle)
 				// Pre: len2 == distance(middle, end)
@@ -106,7 +132,7 @@ STL2_OPEN_NAMESPACE {
 							break;
 						}
 					}
-					if (len1 <= buf.size() || len2 <= buf.size()) {
+					if (buf.try_reserve(len1 < len2 ? len1 : len2)) {
 						merge_adaptive_fn::impl(__stl2::move(begin), __stl2::move(middle),
 							__stl2::move(end), len1, len2, buf, pred, proj);
 						return;
@@ -183,7 +209,8 @@ STL2_OPEN_NAMESPACE {
 			void operator()(I begin, I middle, I end, difference_type_t<I> len1,
 				difference_type_t<I> len2, C&& pred = C{}, P&& proj = P{}) const
 			{
-				temporary_buffer<value_type_t<I>> no_buffer;
+				// Inline storage only: small merges still use a buffer.
+				scratch_vector<value_type_t<I>> no_buffer{nullptr};
 				merge_adaptive(__stl2::move(begin), __stl2::move(middle), __stl2::move(end),
 					len1, len2, no_buffer, __stl2::forward<C>(pred), __stl2::forward<P>(proj));
 			}
@@ -202,11 +229,7 @@ STL2_OPEN_NAMESPACE {
 	{
 		auto len1 = __stl2::distance(first, middle);
 		auto len2_and_end = __stl2::ext::enumerate(middle, __stl2::move(last));
-		auto buf_size = std::min(len1, len2_and_end.count());
-		detail::temporary_buffer<value_type_t<I>> buf;
-		if (is_trivially_move_assignable<value_type_t<I>>() && 8 < buf_size) {
-			buf = detail::temporary_buffer<value_type_t<I>>{buf_size};
-		}
+		detail::scratch_vector<value_type_t<I>> buf;
 		detail::merge_adaptive(__stl2::move(first), __stl2::move(middle), len2_and_end.end(),
 			len1, len2_and_end.count(), buf, __stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
 		return len2_and_end.end();
@@ -221,6 +244,162 @@ STL2_OPEN_NAMESPACE {
 		return __stl2::inplace_merge(__stl2::begin(rng), __stl2::move(middle),
 			__stl2::end(rng), __stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
 	}
+
+	namespace __inplace_merge {
+		template <class EP, class I, class S, class Comp, class Proj>
+		I par(false_type, const EP&, I first, I middle, S last,
+			Comp& comp, Proj& proj)
+		{
+			return __stl2::inplace_merge(__stl2::move(first), __stl2::move(middle),
+				__stl2::move(last), __stl2::ref(comp), __stl2::ref(proj));
+		}
+
+		// Splits the merge as merge_adaptive does, rotates the two inner
+		// parts on k threads, and merges the two independent halves
+		// concurrently, dividing the threads between them by size.
+		template <class I, class Comp, class Proj>
+		void split(std::ptrdiff_t k, I first, I middle, I last,
+			Comp& comp, Proj& proj)
+		{
+			auto const len1 = static_cast<std::ptrdiff_t>(middle - first);
+			auto const len2 = static_cast<std::ptrdiff_t>(last - middle);
+			if (k < 2 || len1 == 0 || len2 == 0) {
+				__stl2::inplace_merge(__stl2::move(first), __stl2::move(middle),
+					__stl2::move(last), __stl2::ref(comp), __stl2::ref(proj));
+				return;
+			}
+			I m1, m2;
+			if (len1 < len2) {
+				m2 = middle + len2 / 2;
+				m1 = __stl2::upper_bound(first, middle, proj(*m2),
+					__stl2::ref(comp), __stl2::ref(proj));
+			} else {
+				m1 = first + len1 / 2;
+				m2 = __stl2::lower_bound(middle, last, proj(*m1),
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+			auto const mid = detail::parallel_rotate(k, m1, middle, m2).begin();
+			auto const n = len1 + len2;
+			auto k1 = k * static_cast<std::ptrdiff_t>(mid - first) / n;
+			k1 = k1 < 1 ? 1 : (k1 > k - 1 ? k - 1 : k1);
+			detail::parallel_for_chunks(2, [&](std::ptrdiff_t c) {
+				if (c == 0) {
+					__inplace_merge::split(k1, first, m1, mid, comp, proj);
+				} else {
+					__inplace_merge::split(k - k1, mid, m2, last, comp, proj);
+				}
+			});
+		}
+
+		// With room for the whole range, both inputs are moved out to the
+		// buffer and merged back with the parallel merge. Otherwise the
+		// merge is split recursively.
+		template <class EP, class I, class S, class Comp, class Proj>
+		I par(true_type, const EP& pol, I first, I middle, S last_,
+			Comp& comp, Proj& proj)
+		{
+			auto const n1 = static_cast<std::ptrdiff_t>(middle - first);
+			auto const n = static_cast<std::ptrdiff_t>(last_ - first);
+			auto const last = first + n;
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2 || n1 == 0 || n1 == n) {
+				return __inplace_merge::par(false_type{}, pol, __stl2::move(first),
+					__stl2::move(middle), __stl2::move(last), comp, proj);
+			}
+
+			using T = value_type_t<I>;
+			auto buf = is_nothrow_move_constructible<T>::value
+				? detail::temporary_buffer<T>{n} : detail::temporary_buffer<T>{};
+			if (buf.size() < n) {
+				__inplace_merge::split(k, __stl2::move(first), __stl2::move(middle),
+					last, comp, proj);
+				return last;
+			}
+
+			T* const tmp = buf.data();
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const hi = detail::chunk_offset(n, k, c + 1);
+				for (auto i = detail::chunk_offset(n, k, c); i < hi; ++i) {
+					detail::construct(tmp[i], __stl2::iter_move(first + i));
+				}
+			});
+			auto destroy = [&] {
+				detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+					auto const hi = detail::chunk_offset(n, k, c + 1);
+					for (auto i = detail::chunk_offset(n, k, c); i < hi; ++i) {
+						detail::destruct(tmp[i]);
+					}
+				});
+			};
+			try {
+				using MI = move_iterator<T*>;
+				__merge::par(true_type{}, pol, MI{tmp}, MI{tmp + n1},
+					MI{tmp + n1}, MI{tmp + n}, first, comp, proj, proj);
+			} catch(...) {
+				destroy();
+				throw;
+			}
+			destroy();
+			return last;
+		}
+	}
+
+	// Extension
+	template <class EP, BidirectionalIterator I, Sentinel<I> S,
+		class Comp = less<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Sortable<I, __f<Comp>, __f<Proj>>
+	I inplace_merge(EP&& pol, I first, I middle, S last,
+		Comp&& comp_ = Comp{}, Proj&& proj_ = Proj{})
+	{
+		auto comp = ext::make_callable_wrapper(__stl2::forward<Comp>(comp_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __inplace_merge::par(meta::bool_<detail::parallel_iterator<I, S>>{},
+			pol, __stl2::move(first), __stl2::move(middle), __stl2::move(last),
+			comp, proj);
+	}
+
+	// Extension
+	template <class EP, BidirectionalRange Rng, class Comp = less<>,
+		class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Sortable<iterator_t<Rng>, __f<Comp>, __f<Proj>>
+	safe_iterator_t<Rng>
+	inplace_merge(EP&& pol, Rng&& rng, iterator_t<Rng> middle,
+		Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		return __stl2::inplace_merge(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::move(middle), __stl2::end(rng),
+			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
+
+	// Extension: draws the temporary buffer from r.
+	template <BidirectionalIterator I, Sentinel<I> S, class Comp = less<>,
+		class Proj = identity>
+	requires
+		models::Sortable<I, __f<Comp>, __f<Proj>>
+	I inplace_merge(ext::scratch_resource& r, I first, I middle, S last,
+		Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		ext::scoped_scratch_resource _{r};
+		return __stl2::inplace_merge(__stl2::move(first), __stl2::move(middle),
+			__stl2::move(last), __stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
+
+	// Extension: draws the temporary buffer from r.
+	template <BidirectionalRange Rng, class Comp = less<>, class Proj = identity>
+	requires
+		models::Sortable<iterator_t<Rng>, __f<Comp>, __f<Proj>>
+	safe_iterator_t<Rng>
+	inplace_merge(ext::scratch_resource& r, Rng&& rng, iterator_t<Rng> middle,
+		Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		ext::scoped_scratch_resource _{r};
+		return __stl2::inplace_merge(__stl2::forward<Rng>(rng), __stl2::move(middle),
+			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
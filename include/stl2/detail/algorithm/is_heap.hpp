@@ -65,6 +65,34 @@ STL2_OPEN_NAMESPACE {
 			__stl2::is_heap_until(rng, __stl2::forward<Comp>(comp),
 				__stl2::forward<Proj>(proj));
 	}
+
+	// Extension
+	template <class EP, RandomAccessIterator I, Sentinel<I> S,
+		class Comp = less<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<I, __f<Proj>>>
+	bool is_heap(EP&& pol, I first, S last,
+		Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		return last == __stl2::is_heap_until(__stl2::forward<EP>(pol),
+			__stl2::move(first), last,
+			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
+
+	// Extension
+	template <class EP, RandomAccessRange Rng, class Comp = less<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<iterator_t<Rng>, __f<Proj>>>
+	bool is_heap(EP&& pol, Rng&& rng, Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		return __stl2::end(rng) ==
+			__stl2::is_heap_until(__stl2::forward<EP>(pol), rng,
+				__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
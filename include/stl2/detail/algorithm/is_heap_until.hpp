@@ -26,6 +26,8 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/simd.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // is_heap_until [is.heap]
@@ -84,6 +86,85 @@ STL2_OPEN_NAMESPACE {
 		return detail::is_heap_until_n(__stl2::begin(rng), __stl2::distance(rng),
 			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
 	}
+
+	namespace __is_heap_until {
+		template <class Fast, class EP, class I, class S, class Comp, class Proj>
+		I par(false_type, Fast, const EP&, I first, S last, Comp& comp, Proj& proj)
+		{
+			return __stl2::is_heap_until(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
+
+		// Children are checked against their parents in index order, so
+		// the first violation found is the one the sequential version
+		// reports.
+		template <class EP, class I, class S, class Comp, class Proj>
+		I par(true_type, false_type, const EP& pol, I first, S last,
+			Comp& comp, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			return first + detail::parallel_find_index(k, n,
+				[&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+					for (lo = lo > 0 ? lo : 1; lo < hi; ++lo) {
+						if (comp(proj(first[(lo - 1) / 2]), proj(first[lo]))) {
+							break;
+						}
+					}
+					return lo < hi ? lo : hi;
+				});
+		}
+
+		template <class EP, class I, class S, class Comp, class Proj>
+		I par(true_type, true_type, const EP& pol, I first, S last,
+			Comp&, Proj&)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			if (n < 2) {
+				return first + n;
+			}
+			auto const p = detail::simd_data(first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			return first + detail::parallel_find_index(k, n,
+				[p](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+					lo = lo > 0 ? lo : 1;
+					return lo < hi ? detail::simd::is_heap_until(p, lo, hi) : hi;
+				});
+		}
+	}
+
+	// Extension
+	template <class EP, RandomAccessIterator I, Sentinel<I> S, class Comp = less<>,
+		class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<I, __f<Proj>>>
+	I is_heap_until(EP&& pol, I first, S last,
+		Comp&& comp_ = Comp{}, Proj&& proj_ = Proj{})
+	{
+		auto comp = ext::make_callable_wrapper(__stl2::forward<Comp>(comp_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __is_heap_until::par(
+			meta::bool_<detail::parallel_iterator<I, S>>{},
+			meta::bool_<detail::simd_range<I, S> &&
+				detail::simd_less<value_type_t<I>, decay_t<Comp>, decay_t<Proj>>>{},
+			pol, __stl2::move(first), __stl2::move(last), comp, proj);
+	}
+
+	// Extension
+	template <class EP, RandomAccessRange Rng, class Comp = less<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<iterator_t<Rng>, __f<Proj>>>
+	safe_iterator_t<Rng>
+	is_heap_until(EP&& pol, Rng&& rng, Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		return __stl2::is_heap_until(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
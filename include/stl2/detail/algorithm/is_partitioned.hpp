@@ -18,6 +18,7 @@
 #include <stl2/detail/algorithm/find_if_not.hpp>
 #include <stl2/detail/algorithm/none_of.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // is_partitioned [alg.partitions]
@@ -57,6 +58,85 @@ STL2_OPEN_NAMESPACE {
 		return __stl2::is_partitioned(__stl2::begin(rng), __stl2::end(rng),
 			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
 	}
+
+	namespace __is_partitioned {
+		template <class EP, class I, class S, class Pred, class Proj>
+		bool par(false_type, const EP&, I first, S last, Pred& pred, Proj& proj)
+		{
+			return __stl2::is_partitioned(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(pred), __stl2::ref(proj));
+		}
+
+		// Each chunk is checked on its own; the range is partitioned if
+		// every chunk is and no chunk containing a true element follows a
+		// chunk containing a false one.
+		template <class EP, class I, class S, class Pred, class Proj>
+		bool par(true_type, const EP& pol, I first, S last, Pred& pred, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __is_partitioned::par(false_type{}, pol, __stl2::move(first),
+					__stl2::move(last), pred, proj);
+			}
+			enum : unsigned char { has_true = 1, has_false = 2, unpartitioned = 4 };
+			auto states = std::make_unique<unsigned char[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const lo = first + detail::chunk_offset(n, k, c);
+				auto const hi = first + detail::chunk_offset(n, k, c + 1);
+				auto const mid = __stl2::find_if_not(lo, hi,
+					__stl2::ref(pred), __stl2::ref(proj));
+				unsigned char state = 0;
+				if (mid != lo) {
+					state |= has_true;
+				}
+				if (mid != hi) {
+					state |= has_false;
+					if (!__stl2::none_of(__stl2::next(mid), hi,
+						__stl2::ref(pred), __stl2::ref(proj))) {
+						state |= unpartitioned;
+					}
+				}
+				states[c] = state;
+			});
+			bool seen_false = false;
+			for (std::ptrdiff_t c = 0; c < k; ++c) {
+				if ((states[c] & unpartitioned) ||
+					(seen_false && (states[c] & has_true))) {
+					return false;
+				}
+				seen_false = seen_false || (states[c] & has_false);
+			}
+			return true;
+		}
+	}
+
+	// Extension
+	template <class EP, InputIterator I, Sentinel<I> S, class Pred, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<I, __f<Proj>>>
+	bool is_partitioned(EP&& pol, I first, S last, Pred&& pred_, Proj&& proj_ = Proj{})
+	{
+		auto pred = ext::make_callable_wrapper(__stl2::forward<Pred>(pred_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __is_partitioned::par(meta::bool_<detail::parallel_iterator<I, S>>{},
+			pol, __stl2::move(first), __stl2::move(last), pred, proj);
+	}
+
+	// Extension
+	template <class EP, InputRange Rng, class Pred, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<iterator_t<Rng>, __f<Proj>>>
+	bool is_partitioned(EP&& pol, Rng&& rng, Pred&& pred, Proj&& proj = Proj{})
+	{
+		return __stl2::is_partitioned(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -13,57 +13,236 @@
 #ifndef STL2_DETAIL_ALGORITHM_IS_PERMUTATION_HPP
 #define STL2_DETAIL_ALGORITHM_IS_PERMUTATION_HPP
 
+#include <cstddef>
+#include <new>
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
+#include <stl2/detail/construct_destruct.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash_value.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/swiss_table.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/memory/relocate.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // is_permutation [alg.is_permutation]
 //
 STL2_OPEN_NAMESPACE {
-	template <ForwardIterator I1, Sentinel<I1> S1,
-		ForwardIterator I2, Sentinel<I2> S2,
-		class Pred, class Proj1, class Proj2>
-	requires
-		models::IndirectlyComparable<I1, I2, Pred, Proj1, Proj2>
-	bool __is_permutation_tail(I1 first1, S1 last1, I2 first2, S2 last2,
-		Pred& pred, Proj1& proj1, Proj2& proj2)
-	{
-		// For each element in [f1, l1), see if there are the same number of
-		// equal elements in [f2, l2)
-		for (I1 i = first1; i != last1; ++i) {
-			// Have we already counted the number of *i in [f1, l1)?
-			for (I1 j = first1; j != i; ++j) {
-				if (pred(proj1(*j), proj1(*i))) {
-						goto next_iter;
+	namespace __is_permutation {
+		template <ForwardIterator I1, Sentinel<I1> S1,
+			ForwardIterator I2, Sentinel<I2> S2,
+			class Pred, class Proj1, class Proj2>
+		requires
+			models::IndirectlyComparable<I1, I2, Pred, Proj1, Proj2>
+		bool quadratic(I1 first1, S1 last1, I2 first2, S2 last2,
+			Pred& pred, Proj1& proj1, Proj2& proj2)
+		{
+			// For each element in [f1, l1), see if there are the same number of
+			// equal elements in [f2, l2)
+			for (I1 i = first1; i != last1; ++i) {
+				// Have we already counted the number of *i in [f1, l1)?
+				for (I1 j = first1; j != i; ++j) {
+					if (pred(proj1(*j), proj1(*i))) {
+							goto next_iter;
+					}
 				}
-			}
-			{
-				// Count number of *i in [f2, l2)
-				difference_type_t<I2> c2 = 0;
-				for (I2 j = first2; j != last2; ++j) {
-					if (pred(proj1(*i), proj2(*j))) {
-						++c2;
+				{
+					// Count number of *i in [f2, l2)
+					difference_type_t<I2> c2 = 0;
+					for (I2 j = first2; j != last2; ++j) {
+						if (pred(proj1(*i), proj2(*j))) {
+							++c2;
+						}
+					}
+					if (c2 == 0) {
+						return false;
+					}
+					// Count number of *i in [i, l1) (we can start with 1)
+					difference_type_t<I1> c1 = 1;
+					for (I1 j = __stl2::next(i); j != last1; ++j) {
+						if (pred(proj1(*i), proj1(*j))) {
+							++c1;
+						}
+					}
+					if (c1 != c2) {
+						return false;
 					}
 				}
-				if (c2 == 0) {
+			next_iter:;
+			}
+			return true;
+		}
+
+		// Projected values both sides share, compared with equal_to<>: a
+		// permutation has the same number of each distinct value on both
+		// sides, which can be counted in a hash table in expected linear
+		// time, or by sorting copies of both sides in O(n log n).
+		template <class Pred>
+		constexpr bool is_equal_to =
+			models::Same<Pred, equal_to<>> ||
+			models::Same<Pred, ext::callable_wrapper<equal_to<>>>;
+
+		template <class I1, class I2, class Pred, class Proj1, class Proj2,
+			class V = decay_t<reference_t<projected<I1, Proj1>>>>
+		constexpr bool by_value =
+			is_equal_to<decay_t<Pred>> &&
+			models::Same<V, decay_t<reference_t<projected<I2, Proj2>>>> &&
+			models::Copyable<V>;
+
+		// Below this many elements the quadratic scan is faster than
+		// allocating.
+		constexpr std::ptrdiff_t cutoff = 32;
+
+		struct quadratic_tag {};
+		struct sort_tag {};
+		struct hash_tag {};
+
+		template <class I1, class I2, class Pred, class Proj1, class Proj2,
+			class V = decay_t<reference_t<projected<I1, Proj1>>>>
+		using strategy = meta::if_c<
+			by_value<I1, I2, Pred, Proj1, Proj2> && models::HashableValue<V>,
+			hash_tag,
+			meta::if_c<
+				by_value<I1, I2, Pred, Proj1, Proj2> && models::StrictTotallyOrdered<V>,
+				sort_tag, quadratic_tag>>;
+
+		template <class I1, class S1, class I2, class S2,
+			class Pred, class Proj1, class Proj2>
+		bool tail(quadratic_tag, I1 first1, S1 last1, I2 first2, S2 last2,
+			std::ptrdiff_t, Pred& pred, Proj1& proj1, Proj2& proj2)
+		{
+			return __is_permutation::quadratic(__stl2::move(first1), __stl2::move(last1),
+				__stl2::move(first2), __stl2::move(last2), pred, proj1, proj2);
+		}
+
+		// A count per distinct projected value. The counts live in a
+		// swiss_table directly, which is all of flat_hash_map this needs.
+		template <class V>
+		struct counted {
+			V value;
+			std::ptrdiff_t count = 0;
+
+			explicit counted(const V& v) : value(v) {}
+			explicit counted(V&& v) : value(__stl2::move(v)) {}
+		};
+
+		template <class V>
+		struct count_policy {
+			using key_type = V;
+			using value_type = counted<V>;
+			using slot_type = counted<V>;
+
+			static const V& key(const slot_type& s) noexcept { return s.value; }
+			static const V& key_of(const value_type& v) noexcept { return v.value; }
+			static value_type& element(slot_type& s) noexcept { return s; }
+
+			template <class...Args>
+			static void construct(slot_type* s, Args&&...args) {
+				detail::construct(*s, __stl2::forward<Args>(args)...);
+			}
+
+			static void destroy(slot_type* s) noexcept {
+				detail::destruct(*s);
+			}
+
+			static constexpr bool nothrow_transfer = detail::nothrow_relocatable<slot_type>;
+
+			static void transfer(slot_type* to, slot_type* from)
+			noexcept(nothrow_transfer)
+			{
+				detail::uninitialized_relocate_n(from, 1, to);
+			}
+		};
+
+		template <class V, class I1, class S1, class I2, class S2,
+			class Proj1, class Proj2>
+		bool count(I1 first1, S1 last1, I2 first2, S2 last2,
+			std::ptrdiff_t n, Proj1& proj1, Proj2& proj2)
+		{
+			detail::swiss_table<count_policy<V>, ext::hasher, equal_to<>> counts{
+				static_cast<std::size_t>(n), ext::hasher{}, equal_to<>{}};
+			for (; first1 != last1; ++first1) {
+				auto&& v = proj1(*first1);
+				auto const i = counts.find_or_emplace(v, [&](counted<V>* s) {
+					count_policy<V>::construct(s, __stl2::forward<decltype(v)>(v));
+				}).first;
+				++(*i).count;
+			}
+			// Both sides have n elements, so every count returns to zero
+			// exactly when none goes negative.
+			for (; first2 != last2; ++first2) {
+				auto i = counts.find(proj2(*first2));
+				if (i == counts.end() || (*i).count-- == 0) {
 					return false;
 				}
-				// Count number of *i in [i, l1) (we can start with 1)
-				difference_type_t<I1> c1 = 1;
-				for (I1 j = __stl2::next(i); j != last1; ++j) {
-					if (pred(proj1(*i), proj1(*j))) {
-						++c1;
+			}
+			return true;
+		}
+
+		// Counts the values in a hash table, or, like the sort_tag overload,
+		// falls back to the quadratic scan when the table cannot be
+		// allocated.
+		template <class I1, class S1, class I2, class S2,
+			class Pred, class Proj1, class Proj2>
+		bool tail(hash_tag, I1 first1, S1 last1, I2 first2, S2 last2,
+			std::ptrdiff_t n, Pred& pred, Proj1& proj1, Proj2& proj2)
+		{
+			if (n >= cutoff) {
+				try {
+					return __is_permutation::count<
+						decay_t<reference_t<projected<I1, Proj1>>>>(
+						first1, last1, first2, last2, n, proj1, proj2);
+				} catch(std::bad_alloc&) {}
+			}
+			return __is_permutation::quadratic(__stl2::move(first1), __stl2::move(last1),
+				__stl2::move(first2), __stl2::move(last2), pred, proj1, proj2);
+		}
+
+		template <class I1, class S1, class I2, class S2,
+			class Pred, class Proj1, class Proj2>
+		bool tail(sort_tag, I1 first1, S1 last1, I2 first2, S2 last2,
+			std::ptrdiff_t n, Pred& pred, Proj1& proj1, Proj2& proj2)
+		{
+			using V = decay_t<reference_t<projected<I1, Proj1>>>;
+			if (n >= cutoff) {
+				auto buf = detail::temporary_buffer<V>{2 * n};
+				if (buf.size() >= 2 * n) {
+					auto vec = detail::make_temporary_vector(buf);
+					for (auto i = first1; i != last1; ++i) {
+						vec.push_back(proj1(*i));
 					}
-				}
-				if (c1 != c2) {
-					return false;
+					for (auto i = first2; i != last2; ++i) {
+						vec.push_back(proj2(*i));
+					}
+					auto const mid = vec.begin() + n;
+					__stl2::sort(vec.begin(), mid);
+					__stl2::sort(mid, vec.end());
+					return __stl2::equal(vec.begin(), mid, mid, vec.end());
 				}
 			}
-		next_iter:;
+			return __is_permutation::quadratic(__stl2::move(first1), __stl2::move(last1),
+				__stl2::move(first2), __stl2::move(last2), pred, proj1, proj2);
 		}
-		return true;
+	}
+
+	template <ForwardIterator I1, Sentinel<I1> S1,
+		ForwardIterator I2, Sentinel<I2> S2,
+		class Pred, class Proj1, class Proj2>
+	requires
+		models::IndirectlyComparable<I1, I2, Pred, Proj1, Proj2>
+	bool __is_permutation_tail(I1 first1, S1 last1, I2 first2, S2 last2,
+		Pred& pred, Proj1& proj1, Proj2& proj2)
+	{
+		// Both sequences have the same length here.
+		auto const n = static_cast<std::ptrdiff_t>(__stl2::distance(first1, last1));
+		return __is_permutation::tail(
+			__is_permutation::strategy<I1, I2, Pred, Proj1, Proj2>{},
+			__stl2::move(first1), __stl2::move(last1),
+			__stl2::move(first2), __stl2::move(last2), n, pred, proj1, proj2);
 	}
 
 	template<ForwardIterator I1, Sentinel<I1> S1, ForwardIterator I2,
@@ -55,6 +55,35 @@ STL2_OPEN_NAMESPACE {
 			__stl2::is_sorted_until(__stl2::begin(rng), __stl2::end(rng),
 				__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
 	}
+
+	// Extension
+	template <class EP, ForwardIterator I, Sentinel<I> S, class Comp = less<>,
+		class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<I, __f<Proj>>>
+	bool is_sorted(EP&& pol, I first, S last,
+		Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		return last == __stl2::is_sorted_until(__stl2::forward<EP>(pol),
+			__stl2::move(first), last,
+			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
+
+	// Extension
+	template <class EP, ForwardRange Rng, class Comp = less<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<iterator_t<Rng>, __f<Proj>>>
+	bool is_sorted(EP&& pol, Rng&& rng, Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		return __stl2::end(rng) ==
+			__stl2::is_sorted_until(__stl2::forward<EP>(pol),
+				__stl2::begin(rng), __stl2::end(rng),
+				__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
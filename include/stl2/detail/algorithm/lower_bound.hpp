@@ -49,6 +49,51 @@ STL2_OPEN_NAMESPACE {
 				__lower_bound_fn<Comp, T>{__stl2::forward<Comp>(comp), value},
 				__stl2::forward<Proj>(proj));
 		}
+
+		// Extension: lower_bound over a random access sequence of n
+		// elements with no data-dependent branch in its loop. Each step
+		// halves the candidate length and conditionally moves the base, a
+		// select the compiler can emit as a conditional move, so searches of
+		// unpredictable keys don't pay for mispredictions. It always performs
+		// ceil(log2(n)) + 1 comparisons.
+		template <class I, class T, class Comp = less<>, class Proj = identity>
+		requires
+			models::RandomAccessIterator<__f<I>> &&
+			models::IndirectCallableStrictWeakOrder<
+				__f<Comp>, const T*, projected<__f<I>, __f<Proj>>>
+		__f<I> branchless_lower_bound_n(I&& first, difference_type_t<__f<I>> n,
+			const T& value, Comp&& comp_ = Comp{}, Proj&& proj_ = Proj{})
+		{
+			STL2_ASSUME(n >= 0);
+			auto comp = ext::make_callable_wrapper(__stl2::forward<Comp>(comp_));
+			auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+			__f<I> base = __stl2::forward<I>(first);
+			if (n == 0) {
+				return base;
+			}
+			while (n > 1) {
+				auto const half = n / 2;
+				base = comp(proj(base[half]), value) ? base + half : base;
+				n -= half;
+			}
+			return base + static_cast<difference_type_t<__f<I>>>(
+				comp(proj(*base), value));
+		}
+
+		template <RandomAccessRange Rng, class T, class Comp = less<>,
+			class Proj = identity>
+		requires
+			models::SizedRange<Rng> &&
+			models::IndirectCallableStrictWeakOrder<
+				__f<Comp>, const T*, projected<iterator_t<Rng>, __f<Proj>>>
+		safe_iterator_t<Rng>
+		branchless_lower_bound(Rng&& rng, const T& value,
+			Comp&& comp = Comp{}, Proj&& proj = Proj{})
+		{
+			return ext::branchless_lower_bound_n(
+				__stl2::begin(rng), __stl2::distance(rng), value,
+				__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+		}
 	}
 
 	template <class I, class S, class T, class Comp = less<>, class Proj = identity>
@@ -12,9 +12,11 @@
 #ifndef STL2_DETAIL_ALGORITHM_MERGE_HPP
 #define STL2_DETAIL_ALGORITHM_MERGE_HPP
 
+#include <memory>
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/tuple.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
@@ -51,12 +53,12 @@ STL2_OPEN_NAMESPACE {
 			}
 			reference_t<I1>&& v1 = *first1;
 			reference_t<I2>&& v2 = *first2;
-			if (comp(proj1(v1), proj2(v2))) {
-				*result = __stl2::forward<reference_t<I1>>(v1);
-				++first1;
-			} else {
+			if (comp(proj2(v2), proj1(v1))) {
 				*result = __stl2::forward<reference_t<I2>>(v2);
 				++first2;
+			} else {
+				*result = __stl2::forward<reference_t<I1>>(v1);
+				++first1;
 			}
 			++result;
 		}
@@ -138,6 +140,254 @@ STL2_OPEN_NAMESPACE {
 			__stl2::forward<O>(result), __stl2::forward<Comp>(comp),
 			__stl2::forward<Proj1>(proj1), __stl2::forward<Proj2>(proj2));
 	}
+
+	namespace detail {
+		// Smallest i in [lo, hi) such that !pred(i), or hi if there is none.
+		// Requires: pred is true on a prefix of [lo, hi) and false after.
+		template <class Pred>
+		std::ptrdiff_t first_false(std::ptrdiff_t lo, std::ptrdiff_t hi,
+			Pred&& pred)
+		{
+			while (lo < hi) {
+				auto const mid = lo + (hi - lo) / 2;
+				if (pred(mid)) {
+					lo = mid + 1;
+				} else {
+					hi = mid;
+				}
+			}
+			return lo;
+		}
+
+		// Co-ranking: the number of elements of a (of n1) among the first d
+		// elements of the merge of a and b (of n2), where a_first(i, j) is true
+		// iff a[i] is output before b[j].
+		template <class AFirst>
+		std::ptrdiff_t merge_path(std::ptrdiff_t d, std::ptrdiff_t n1,
+			std::ptrdiff_t n2, AFirst&& a_first)
+		{
+			auto const lo = d > n2 ? d - n2 : 0;
+			auto const hi = d < n1 ? d : n1;
+			return detail::first_false(lo, hi, [&](std::ptrdiff_t i) {
+				return a_first(i, d - 1 - i);
+			});
+		}
+
+		// Output iterator that discards values and counts how many it was
+		// asked to store. Used to size each chunk's share of an output range
+		// before writing it.
+		struct counting_output {
+			struct proxy {
+				template <class T>
+				const proxy& operator=(T&&) const noexcept { return *this; }
+			};
+
+			using difference_type = std::ptrdiff_t;
+
+			std::ptrdiff_t count = 0;
+
+			proxy operator*() const noexcept { return {}; }
+			counting_output& operator++() noexcept {
+				++count;
+				return *this;
+			}
+			counting_output operator++(int) noexcept {
+				auto tmp = *this;
+				++count;
+				return tmp;
+			}
+		};
+
+		// Splits sorted ranges a (of n1) and b (of n2) into k pairs of
+		// subranges at balanced co-rank points, then moves each split back to
+		// the nearest boundary between runs of equivalent elements so that no
+		// run straddles two pairs. The set algorithms produce identical output
+		// when run independently on each pair. On return, the c-th pair is
+		// [i[c], i[c+1]) x [j[c], j[c+1]).
+		template <RandomAccessIterator I1, RandomAccessIterator I2,
+			class Comp, class Proj1, class Proj2>
+		void set_split(std::ptrdiff_t k, I1 a, std::ptrdiff_t n1,
+			I2 b, std::ptrdiff_t n2, Comp& comp, Proj1& proj1, Proj2& proj2,
+			std::ptrdiff_t* i, std::ptrdiff_t* j)
+		{
+			auto const n = n1 + n2;
+			i[0] = j[0] = 0;
+			i[k] = n1;
+			j[k] = n2;
+			for (std::ptrdiff_t c = 1; c < k; ++c) {
+				auto const d = detail::chunk_offset(n, k, c);
+				auto const x = detail::merge_path(d, n1, n2,
+					[&](std::ptrdiff_t p, std::ptrdiff_t q) {
+						reference_t<I1>&& u = a[p];
+						reference_t<I2>&& v = b[q];
+						return !comp(proj2(v), proj1(u));
+					});
+				auto const y = d - x;
+				auto split = [&](auto&& pivot) {
+					i[c] = detail::first_false(0, n1, [&](std::ptrdiff_t p) {
+						reference_t<I1>&& u = a[p];
+						return comp(proj1(u), pivot);
+					});
+					j[c] = detail::first_false(0, n2, [&](std::ptrdiff_t q) {
+						reference_t<I2>&& v = b[q];
+						return comp(proj2(v), pivot);
+					});
+				};
+				if (y == n2) {
+					reference_t<I1>&& u = a[x];
+					split(proj1(u));
+				} else if (x == n1) {
+					reference_t<I2>&& v = b[y];
+					split(proj2(v));
+				} else {
+					reference_t<I1>&& u = a[x];
+					reference_t<I2>&& v = b[y];
+					if (!comp(proj2(v), proj1(u))) {
+						split(proj1(u));
+					} else {
+						split(proj2(v));
+					}
+				}
+			}
+		}
+
+		// Runs op(a_lo, a_hi, b_lo, b_hi, out) - a sequential set algorithm
+		// returning its final output iterator - on the k pairs of subranges
+		// produced by set_split, first into counting_outputs to size each
+		// pair's output, then into disjoint slices of result.
+		template <RandomAccessIterator I1, RandomAccessIterator I2,
+			RandomAccessIterator O, class Comp, class Proj1, class Proj2, class Op>
+		O parallel_set_operation(std::ptrdiff_t k, I1 a, std::ptrdiff_t n1,
+			I2 b, std::ptrdiff_t n2, O result, Comp& comp, Proj1& proj1,
+			Proj2& proj2, Op&& op)
+		{
+			auto i = std::make_unique<std::ptrdiff_t[]>(k + 1);
+			auto j = std::make_unique<std::ptrdiff_t[]>(k + 1);
+			detail::set_split(k, a, n1, b, n2, comp, proj1, proj2, i.get(), j.get());
+
+			auto offsets = std::make_unique<std::ptrdiff_t[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				offsets[c] = op(a + i[c], a + i[c + 1], b + j[c], b + j[c + 1],
+					counting_output{}).count;
+			});
+			auto const total = detail::exclusive_scan_counts(offsets.get(), k);
+
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				op(a + i[c], a + i[c + 1], b + j[c], b + j[c + 1],
+					result + static_cast<difference_type_t<O>>(offsets[c]));
+			});
+			return result + static_cast<difference_type_t<O>>(total);
+		}
+	}
+
+	namespace __merge {
+		template <class EP, class I1, class S1, class I2, class S2, class O,
+			class Comp, class Proj1, class Proj2>
+		tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>
+		par(false_type, const EP&, I1 first1, S1 last1, I2 first2, S2 last2,
+			O result, Comp& comp, Proj1& proj1, Proj2& proj2)
+		{
+			return __stl2::merge(__stl2::move(first1), __stl2::move(last1),
+				__stl2::move(first2), __stl2::move(last2), __stl2::move(result),
+				__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2));
+		}
+
+		// The output is cut into k equal slices; merge_path finds where each
+		// slice begins in both inputs, using the same tie-breaking rule as the
+		// sequential merge, and each slice is merged independently.
+		template <class EP, class I1, class S1, class I2, class S2, class O,
+			class Comp, class Proj1, class Proj2>
+		tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>
+		par(true_type, const EP& pol, I1 first1, S1 last1, I2 first2, S2 last2,
+			O result, Comp& comp, Proj1& proj1, Proj2& proj2)
+		{
+			auto const n1 = static_cast<std::ptrdiff_t>(last1 - first1);
+			auto const n2 = static_cast<std::ptrdiff_t>(last2 - first2);
+			auto const n = n1 + n2;
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __merge::par(false_type{}, pol,
+					__stl2::move(first1), __stl2::move(last1),
+					__stl2::move(first2), __stl2::move(last2),
+					__stl2::move(result), comp, proj1, proj2);
+			}
+
+			// The elements are bound as lvalues so that a projection taking
+			// its argument by value cannot move from a move_iterator's element.
+			auto a_first = [&](std::ptrdiff_t i, std::ptrdiff_t j) -> bool {
+				reference_t<I1>&& v1 = first1[i];
+				reference_t<I2>&& v2 = first2[j];
+				return !comp(proj2(v2), proj1(v1));
+			};
+			// All the splits are found before any slice is merged: merging a
+			// slice from move_iterators moves from elements that the searches
+			// for the other slices' splits read.
+			auto split = std::make_unique<std::ptrdiff_t[]>(k + 1);
+			split[0] = 0;
+			split[k] = n1;
+			for (std::ptrdiff_t c = 1; c < k; ++c) {
+				split[c] = detail::merge_path(detail::chunk_offset(n, k, c),
+					n1, n2, a_first);
+			}
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const d0 = detail::chunk_offset(n, k, c);
+				auto const d1 = detail::chunk_offset(n, k, c + 1);
+				auto const i0 = split[c];
+				auto const i1 = split[c + 1];
+				__stl2::merge(first1 + i0, first1 + i1,
+					first2 + (d0 - i0), first2 + (d1 - i1),
+					result + static_cast<difference_type_t<O>>(d0),
+					__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2));
+			});
+			return {first1 + n1, first2 + n2,
+				result + static_cast<difference_type_t<O>>(n)};
+		}
+	}
+
+	// Extension
+	template <class EP, InputIterator I1, Sentinel<I1> S1,
+		InputIterator I2, Sentinel<I2> S2,
+		class O, class Comp = less<>,
+		class Proj1 = identity, class Proj2 = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Mergeable<I1, I2, O, __f<Comp>, __f<Proj1>, __f<Proj2>>
+	tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>
+	merge(EP&& pol, I1 first1, S1 last1, I2 first2, S2 last2, O result,
+		Comp&& comp_ = Comp{}, Proj1&& proj1_ = Proj1{},
+		Proj2&& proj2_ = Proj2{})
+	{
+		auto comp = ext::make_callable_wrapper(__stl2::forward<Comp>(comp_));
+		auto proj1 = ext::make_callable_wrapper(__stl2::forward<Proj1>(proj1_));
+		auto proj2 = ext::make_callable_wrapper(__stl2::forward<Proj2>(proj2_));
+		return __merge::par(
+			meta::bool_<detail::parallel_iterator<I1, S1> &&
+				detail::parallel_iterator<I2, S2> &&
+				models::RandomAccessIterator<O>>{},
+			pol, __stl2::move(first1), __stl2::move(last1),
+			__stl2::move(first2), __stl2::move(last2), __stl2::move(result),
+			comp, proj1, proj2);
+	}
+
+	// Extension
+	template <class EP, InputRange Rng1, InputRange Rng2, class O,
+		class Comp = less<>, class Proj1 = identity, class Proj2 = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Mergeable<
+			iterator_t<Rng1>, iterator_t<Rng2>, __f<O>,
+			__f<Comp>, __f<Proj1>, __f<Proj2>>
+	tagged_tuple<tag::in1(safe_iterator_t<Rng1>), tag::in2(safe_iterator_t<Rng2>),
+		tag::out(__f<O>)>
+	merge(EP&& pol, Rng1&& rng1, Rng2&& rng2, O&& result, Comp&& comp = Comp{},
+		Proj1&& proj1 = Proj1{}, Proj2&& proj2 = Proj2{})
+	{
+		return __stl2::merge(__stl2::forward<EP>(pol),
+			__stl2::begin(rng1), __stl2::end(rng1),
+			__stl2::begin(rng2), __stl2::end(rng2),
+			__stl2::forward<O>(result), __stl2::forward<Comp>(comp),
+			__stl2::forward<Proj1>(proj1), __stl2::forward<Proj2>(proj2));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
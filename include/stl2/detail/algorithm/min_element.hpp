@@ -17,6 +17,8 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/simd.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // min_element [alg.min.max]
@@ -64,6 +66,91 @@ STL2_OPEN_NAMESPACE {
 		return __stl2::min_element(__stl2::begin(rng), __stl2::end(rng),
 			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
 	}
+
+	namespace __min_element {
+		template <class I, class Comp, class Proj>
+		I chunk(false_type, I first, I last, Comp& comp, Proj& proj)
+		{
+			return __stl2::min_element(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
+
+		// Requires: first != last
+		template <class I, class Comp, class Proj>
+		I chunk(true_type, I first, I last, Comp&, Proj&)
+		{
+			return first + detail::simd::first_min(detail::simd_data(first),
+				static_cast<std::ptrdiff_t>(last - first));
+		}
+
+		template <class Fast, class EP, class I, class S, class Comp, class Proj>
+		I par(false_type, Fast, const EP&, I first, S last, Comp& comp, Proj& proj)
+		{
+			return __stl2::min_element(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
+
+		template <class Fast, class EP, class I, class S, class Comp, class Proj>
+		I par(true_type, Fast, const EP& pol, I first, S last, Comp& comp, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			if (n == 0) {
+				return first;
+			}
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __min_element::chunk(Fast{}, first, first + n, comp, proj);
+			}
+			auto results = std::make_unique<I[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				results[c] = __min_element::chunk(Fast{},
+					first + detail::chunk_offset(n, k, c),
+					first + detail::chunk_offset(n, k, c + 1), comp, proj);
+			});
+			// Earlier chunks win ties.
+			I result = results[0];
+			for (std::ptrdiff_t c = 1; c < k; ++c) {
+				if (comp(proj(*results[c]), proj(*result))) {
+					result = results[c];
+				}
+			}
+			return result;
+		}
+	}
+
+	// Extension
+	template <class EP, ForwardIterator I, Sentinel<I> S,
+		class Comp = less<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<I, __f<Proj>>>
+	I min_element(EP&& pol, I first, S last,
+		Comp&& comp_ = Comp{}, Proj&& proj_ = Proj{})
+	{
+		auto comp = ext::make_callable_wrapper(__stl2::forward<Comp>(comp_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __min_element::par(
+			meta::bool_<detail::parallel_iterator<I, S>>{},
+			meta::bool_<detail::simd_range<I, S> &&
+				is_integral<value_type_t<I>>::value &&
+				detail::simd_less<value_type_t<I>, decay_t<Comp>, decay_t<Proj>>>{},
+			pol, __stl2::move(first), __stl2::move(last), comp, proj);
+	}
+
+	// Extension
+	template <class EP, ForwardRange Rng, class Comp = less<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<iterator_t<Rng>, __f<Proj>>>
+	safe_iterator_t<Rng>
+	min_element(EP&& pol, Rng&& rng, Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		return __stl2::min_element(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -23,6 +23,8 @@
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 #include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/execution.hpp>
+#include <stl2/detail/simd.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // minmax_element [alg.min.max]
@@ -99,6 +101,102 @@ STL2_OPEN_NAMESPACE {
 		return __stl2::minmax_element(__stl2::begin(rng), __stl2::end(rng),
 			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
 	}
+
+	namespace __minmax_element {
+		template <class I, class Comp, class Proj>
+		tagged_pair<tag::min(I), tag::max(I)>
+		chunk(false_type, I first, I last, Comp& comp, Proj& proj)
+		{
+			return __stl2::minmax_element(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
+
+		// Requires: first != last
+		template <class I, class Comp, class Proj>
+		tagged_pair<tag::min(I), tag::max(I)>
+		chunk(true_type, I first, I last, Comp&, Proj&)
+		{
+			auto const p = detail::simd_data(first);
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			return {first + detail::simd::first_min(p, n),
+				first + detail::simd::last_max(p, n)};
+		}
+
+		template <class Fast, class EP, class I, class S, class Comp, class Proj>
+		tagged_pair<tag::min(I), tag::max(I)>
+		par(false_type, Fast, const EP&, I first, S last, Comp& comp, Proj& proj)
+		{
+			return __stl2::minmax_element(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(comp), __stl2::ref(proj));
+		}
+
+		template <class Fast, class EP, class I, class S, class Comp, class Proj>
+		tagged_pair<tag::min(I), tag::max(I)>
+		par(true_type, Fast, const EP& pol, I first, S last, Comp& comp, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			if (n == 0) {
+				return {first, first};
+			}
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __minmax_element::chunk(Fast{}, first, first + n, comp, proj);
+			}
+			auto results = std::make_unique<tagged_pair<tag::min(I), tag::max(I)>[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				results[c] = __minmax_element::chunk(Fast{},
+					first + detail::chunk_offset(n, k, c),
+					first + detail::chunk_offset(n, k, c + 1), comp, proj);
+			});
+			// First minimum, last maximum: earlier chunks win ties for the
+			// minimum and later chunks win ties for the maximum.
+			auto result = results[0];
+			for (std::ptrdiff_t c = 1; c < k; ++c) {
+				if (comp(proj(*results[c].first), proj(*result.first))) {
+					result.first = results[c].first;
+				}
+				if (!comp(proj(*results[c].second), proj(*result.second))) {
+					result.second = results[c].second;
+				}
+			}
+			return result;
+		}
+	}
+
+	// Extension
+	template <class EP, ForwardIterator I, Sentinel<I> S,
+		class Comp = less<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<I, __f<Proj>>>
+	tagged_pair<tag::min(I), tag::max(I)>
+	minmax_element(EP&& pol, I first, S last,
+		Comp&& comp_ = Comp{}, Proj&& proj_ = Proj{})
+	{
+		auto comp = ext::make_callable_wrapper(__stl2::forward<Comp>(comp_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __minmax_element::par(
+			meta::bool_<detail::parallel_iterator<I, S>>{},
+			meta::bool_<detail::simd_range<I, S> &&
+				is_integral<value_type_t<I>>::value &&
+				detail::simd_less<value_type_t<I>, decay_t<Comp>, decay_t<Proj>>>{},
+			pol, __stl2::move(first), __stl2::move(last), comp, proj);
+	}
+
+	// Extension
+	template <class EP, ForwardRange Rng, class Comp = less<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallableStrictWeakOrder<
+			__f<Comp>, projected<iterator_t<Rng>, __f<Proj>>>
+	tagged_pair<tag::min(safe_iterator_t<Rng>), tag::max(safe_iterator_t<Rng>)>
+	minmax_element(EP&& pol, Rng&& rng, Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		return __stl2::minmax_element(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -24,6 +24,7 @@
 
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/find_if_not.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
@@ -92,6 +93,148 @@ STL2_OPEN_NAMESPACE {
 		return __stl2::partition(__stl2::begin(rng), __stl2::end(rng),
 			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
 	}
+
+	namespace __partition {
+		template <class EP, class I, class S, class Pred, class Proj>
+		I par(false_type, const EP&, I first, S last, Pred& pred, Proj& proj)
+		{
+			return __stl2::partition(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(pred), __stl2::ref(proj));
+		}
+
+		// A list of disjoint intervals [begin, begin + size) of positions,
+		// in increasing order.
+		struct intervals {
+			std::unique_ptr<std::ptrdiff_t[]> begin, size;
+			std::ptrdiff_t count = 0;
+
+			explicit intervals(std::ptrdiff_t capacity)
+			: begin{std::make_unique<std::ptrdiff_t[]>(capacity)}
+			, size{std::make_unique<std::ptrdiff_t[]>(capacity)} {}
+
+			void push_back(std::ptrdiff_t b, std::ptrdiff_t e) noexcept {
+				if (b < e) {
+					begin[count] = b;
+					size[count] = e - b;
+					++count;
+				}
+			}
+
+			// Position of the element with the given rank.
+			std::ptrdiff_t locate(std::ptrdiff_t rank, std::ptrdiff_t& i) const noexcept {
+				i = 0;
+				while (rank >= size[i]) {
+					rank -= size[i];
+					++i;
+				}
+				return begin[i] + rank;
+			}
+		};
+
+		// Each chunk is partitioned concurrently, leaving the sequence as k
+		// runs of [trues, falses). With t the total number of true elements,
+		// the falses left of t and the trues right of t are equal in number;
+		// pairing them up by rank and swapping each pair finishes the job, and
+		// the swaps are again split evenly across threads.
+		template <class EP, class I, class S, class Pred, class Proj>
+		I par(true_type, const EP& pol, I first, S last, Pred& pred, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __partition::par(false_type{}, pol, __stl2::move(first),
+					__stl2::move(last), pred, proj);
+			}
+
+			auto mids = std::make_unique<std::ptrdiff_t[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const lo = first + detail::chunk_offset(n, k, c);
+				auto const hi = first + detail::chunk_offset(n, k, c + 1);
+				mids[c] = __stl2::partition(lo, hi,
+					__stl2::ref(pred), __stl2::ref(proj)) - first;
+			});
+
+			std::ptrdiff_t t = 0;
+			for (std::ptrdiff_t c = 0; c < k; ++c) {
+				t += mids[c] - detail::chunk_offset(n, k, c);
+			}
+
+			auto falses = intervals{k};
+			auto trues = intervals{k};
+			std::ptrdiff_t m = 0;
+			for (std::ptrdiff_t c = 0; c < k; ++c) {
+				auto const lo = detail::chunk_offset(n, k, c);
+				auto const hi = detail::chunk_offset(n, k, c + 1);
+				if (mids[c] < t) {
+					auto const e = hi < t ? hi : t;
+					falses.push_back(mids[c], e);
+					m += e - mids[c];
+				}
+				trues.push_back(lo > t ? lo : t, mids[c]);
+			}
+
+			auto const kk = detail::parallel_chunk_count(pol, m);
+			detail::parallel_for_chunks(kk, [&](std::ptrdiff_t j) {
+				auto r = detail::chunk_offset(m, kk, j);
+				auto const r_end = detail::chunk_offset(m, kk, j + 1);
+				if (r == r_end) {
+					return;
+				}
+				std::ptrdiff_t fi, ti;
+				auto f = falses.locate(r, fi);
+				auto g = trues.locate(r, ti);
+				auto f_end = falses.begin[fi] + falses.size[fi];
+				auto g_end = trues.begin[ti] + trues.size[ti];
+				while (true) {
+					__stl2::iter_swap(first + f, first + g);
+					if (++r == r_end) {
+						break;
+					}
+					if (++f == f_end) {
+						++fi;
+						f = falses.begin[fi];
+						f_end = f + falses.size[fi];
+					}
+					if (++g == g_end) {
+						++ti;
+						g = trues.begin[ti];
+						g_end = g + trues.size[ti];
+					}
+				}
+			});
+			return first + t;
+		}
+	}
+
+	// Extension
+	template <class EP, Permutable I, Sentinel<I> S, class Pred,
+		class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<I, __f<Proj>>>
+	I partition(EP&& pol, I first, S last, Pred&& pred_, Proj&& proj_ = Proj{})
+	{
+		auto pred = ext::make_callable_wrapper(__stl2::forward<Pred>(pred_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __partition::par(meta::bool_<detail::parallel_iterator<I, S>>{},
+			pol, __stl2::move(first), __stl2::move(last), pred, proj);
+	}
+
+	// Extension
+	template <class EP, ForwardRange Rng, class Pred, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Permutable<iterator_t<Rng>> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<iterator_t<Rng>, __f<Proj>>>
+	safe_iterator_t<Rng>
+	partition(EP&& pol, Rng&& rng, Pred&& pred, Proj&& proj = Proj{})
+	{
+		return __stl2::partition(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -13,8 +13,12 @@
 #define STL2_DETAIL_ALGORITHM_REMOVE_HPP
 
 #include <stl2/iterator.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/temporary_vector.hpp>
 #include <stl2/detail/algorithm/find_if.hpp>
+#include <stl2/detail/algorithm/move.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
@@ -56,6 +60,118 @@ STL2_OPEN_NAMESPACE {
 			__stl2::begin(rng), __stl2::end(rng),
 			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
 	}
+
+	namespace __remove_if {
+		template <class EP, class I, class S, class Pred, class Proj>
+		I par(false_type, const EP&, I first, S last, Pred& pred, Proj& proj)
+		{
+			return __stl2::remove_if(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(pred), __stl2::ref(proj));
+		}
+
+		// Each chunk is compacted in place concurrently, then the compacted
+		// blocks are slid left to their final offsets. Blocks in the prefix
+		// before the first removed element are already in place; the rest are
+		// staged through a temporary buffer so they can move concurrently
+		// without trampling each other, or slid sequentially if no buffer is
+		// available.
+		template <class EP, class I, class S, class Pred, class Proj>
+		I par(true_type, const EP& pol, I first, S last, Pred& pred, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __remove_if::par(false_type{}, pol, __stl2::move(first),
+					__stl2::move(last), pred, proj);
+			}
+
+			auto offsets = std::make_unique<std::ptrdiff_t[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const lo = first + detail::chunk_offset(n, k, c);
+				auto const hi = first + detail::chunk_offset(n, k, c + 1);
+				offsets[c] = __stl2::remove_if(lo, hi,
+					__stl2::ref(pred), __stl2::ref(proj)) - lo;
+			});
+			auto counts = std::make_unique<std::ptrdiff_t[]>(k);
+			for (std::ptrdiff_t c = 0; c < k; ++c) {
+				counts[c] = offsets[c];
+			}
+			auto const total = detail::exclusive_scan_counts(offsets.get(), k);
+
+			std::ptrdiff_t c0 = 0;
+			while (c0 < k && offsets[c0] == detail::chunk_offset(n, k, c0)) {
+				++c0;
+			}
+			if (c0 == k) {
+				return first + total;
+			}
+
+			using T = value_type_t<I>;
+			auto const base = offsets[c0];
+			auto const m = total - base;
+			// The buffer is filled by construction and drained by
+			// assignment; if either could throw, slide in place instead.
+			auto buf = is_nothrow_move_constructible<T>::value &&
+				is_nothrow_move_assignable<T>::value
+				? detail::temporary_buffer<T>{m} : detail::temporary_buffer<T>{};
+			if (buf.size() < m) {
+				for (auto c = c0; c < k; ++c) {
+					auto const lo = first + detail::chunk_offset(n, k, c);
+					__stl2::move(lo, lo + counts[c], first + offsets[c]);
+				}
+				return first + total;
+			}
+
+			T* const tmp = buf.data();
+			detail::parallel_for_chunks(k - c0, [&](std::ptrdiff_t i) {
+				auto const c = c0 + i;
+				auto src = first + detail::chunk_offset(n, k, c);
+				for (auto j = offsets[c] - base, e = j + counts[c]; j < e; ++j, ++src) {
+					detail::construct(tmp[j], __stl2::iter_move(src));
+				}
+			});
+			detail::parallel_for_chunks(k - c0, [&](std::ptrdiff_t i) {
+				auto const c = c0 + i;
+				auto dst = first + offsets[c];
+				for (auto j = offsets[c] - base, e = j + counts[c]; j < e; ++j, ++dst) {
+					*dst = __stl2::move(tmp[j]);
+					detail::destruct(tmp[j]);
+				}
+			});
+			return first + total;
+		}
+	}
+
+	// Extension
+	template <class EP, ForwardIterator I, Sentinel<I> S, class Pred,
+		class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Permutable<I> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<I, __f<Proj>>>
+	I remove_if(EP&& pol, I first, S last, Pred&& pred_, Proj&& proj_ = Proj{})
+	{
+		auto pred = ext::make_callable_wrapper(__stl2::forward<Pred>(pred_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __remove_if::par(meta::bool_<detail::parallel_iterator<I, S>>{},
+			pol, __stl2::move(first), __stl2::move(last), pred, proj);
+	}
+
+	// Extension
+	template <class EP, ForwardRange Rng, class Pred, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Permutable<iterator_t<Rng>> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<iterator_t<Rng>, __f<Proj>>>
+	safe_iterator_t<Rng>
+	remove_if(EP&& pol, Rng&& rng, Pred&& pred, Proj&& proj = Proj{})
+	{
+		return __stl2::remove_if(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
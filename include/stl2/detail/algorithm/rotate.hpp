@@ -25,6 +25,7 @@
 #include <stl2/iterator.hpp>
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/algorithm/move.hpp>
 #include <stl2/detail/algorithm/move_backward.hpp>
 #include <stl2/detail/algorithm/swap_ranges.hpp>
@@ -209,6 +210,45 @@ STL2_OPEN_NAMESPACE {
 	{
 		return __stl2::rotate(__stl2::begin(rng), __stl2::move(middle), __stl2::end(rng));
 	}
+
+	namespace detail {
+		// Rotates [first, last) on k threads by reversing both halves and
+		// then the whole range, splitting the swaps of each pass evenly.
+		template <RandomAccessIterator I>
+		requires
+			models::Permutable<I>
+		ext::range<I> parallel_rotate(std::ptrdiff_t k, I first, I middle, I last)
+		{
+			auto const n1 = static_cast<std::ptrdiff_t>(middle - first);
+			auto const n2 = static_cast<std::ptrdiff_t>(last - middle);
+			if (k < 2 || n1 == 0 || n2 == 0) {
+				return __stl2::rotate(__stl2::move(first),
+					__stl2::move(middle), __stl2::move(last));
+			}
+			auto const h1 = n1 / 2;
+			auto const swaps = h1 + n2 / 2;
+			auto const k1 = swaps < k ? (swaps > 0 ? swaps : 1) : k;
+			detail::parallel_for_chunks(k1, [&](std::ptrdiff_t c) {
+				auto const hi = detail::chunk_offset(swaps, k1, c + 1);
+				for (auto i = detail::chunk_offset(swaps, k1, c); i < hi; ++i) {
+					if (i < h1) {
+						__stl2::iter_swap(first + i, middle - (i + 1));
+					} else {
+						__stl2::iter_swap(middle + (i - h1), last - (i - h1 + 1));
+					}
+				}
+			});
+			auto const half = (n1 + n2) / 2;
+			auto const k2 = half < k ? (half > 0 ? half : 1) : k;
+			detail::parallel_for_chunks(k2, [&](std::ptrdiff_t c) {
+				auto const hi = detail::chunk_offset(half, k2, c + 1);
+				for (auto i = detail::chunk_offset(half, k2, c); i < hi; ++i) {
+					__stl2::iter_swap(first + i, last - (i + 1));
+				}
+			});
+			return {first + n2, __stl2::move(last)};
+		}
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
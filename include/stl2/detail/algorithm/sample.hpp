@@ -13,8 +13,12 @@
 #ifndef RANGES_V3_ALGORITHM_SAMPLE_HPP
 #define RANGES_V3_ALGORITHM_SAMPLE_HPP
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <stl2/iterator.hpp>
 #include <stl2/random.hpp>
+#include <stl2/detail/bounded_rand.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/randutils.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
@@ -36,13 +40,13 @@ STL2_OPEN_NAMESPACE {
 		sized_impl(I first, S last, difference_type_t<I> pop_size,
 			O out, difference_type_t<I> n, Gen& gen)
 		{
-			__stl2::uniform_int_distribution<difference_type_t<I>> dist;
-			using param_t = typename decltype(dist)::param_type;
 			if (n > pop_size) {
 				n = pop_size;
 			}
 			for (; n > 0 && first != last; ++first) {
-				if (dist(gen, param_t{0, --pop_size}) < n) {
+				auto const i = ext::bounded_rand(gen,
+					static_cast<std::uint64_t>(pop_size--));
+				if (static_cast<difference_type_t<I>>(i) < n) {
 					--n;
 					*out = *first;
 					++out;
@@ -50,6 +54,36 @@ STL2_OPEN_NAMESPACE {
 			}
 			return {__stl2::move(first), __stl2::move(out)};
 		}
+
+		// Li's Algorithm L ("Reservoir-Sampling Algorithms of Time
+		// Complexity O(n(1 + log(N/n)))", 1994): instead of a draw for
+		// every element, draws how many elements to pass over before the
+		// next one that enters the reservoir out[0, n), for O(n log(N/n))
+		// draws in all. The skips go through advance, so they take
+		// constant time for sized iterators. Returns the end of the input.
+		template <class I, class S, class O, class Gen>
+		I reservoir(I first, S last, O out, difference_type_t<I> n, Gen& gen)
+		{
+			using D = difference_type_t<I>;
+			auto const k = static_cast<double>(n);
+			auto w = std::exp(std::log(detail::open_unit(gen)) / k);
+			while (true) {
+				auto const skip = std::floor(
+					std::log(detail::open_unit(gen)) / std::log1p(-w));
+				if (!(skip < static_cast<double>(std::numeric_limits<D>::max()))) {
+					__stl2::advance(first, __stl2::move(last));
+					return first;
+				}
+				if (__stl2::advance(first, static_cast<D>(skip), last) != 0 ||
+					first == last) {
+					return first;
+				}
+				auto const i = ext::bounded_rand(gen, static_cast<std::uint64_t>(n));
+				out[static_cast<D>(i)] = *first;
+				++first;
+				w *= std::exp(std::log(detail::open_unit(gen)) / k);
+			}
+		}
 	}
 
 	template <class I, class S, class O,
@@ -84,14 +118,8 @@ STL2_OPEN_NAMESPACE {
 			}
 			out[i] = *first;
 		}
-		__stl2::uniform_int_distribution<difference_type_t<I>> dist;
-		using param_t = typename decltype(dist)::param_type;
-		for (auto pop_size = n; first != last; (void)++first, ++pop_size) {
-			auto const i = dist(gen, param_t{0, pop_size});
-			if (i < n) {
-				out[i] = *first;
-			}
-		}
+		first = __sample::reservoir(__stl2::move(first), __stl2::move(last),
+			out, n, gen);
 		out += n;
 	done:
 		return {__stl2::move(first), __stl2::move(out)};
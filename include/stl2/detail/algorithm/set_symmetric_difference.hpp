@@ -15,8 +15,10 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/tuple.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/merge.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -149,6 +151,91 @@ STL2_OPEN_NAMESPACE {
 			__stl2::forward<Comp>(comp), __stl2::forward<Proj1>(proj1),
 			__stl2::forward<Proj2>(proj2));
 	}
+
+	namespace __set_symmetric_difference {
+		template <class EP, class I1, class S1, class I2, class S2, class O,
+			class Comp, class Proj1, class Proj2>
+		tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>
+		par(false_type, const EP&, I1 first1, S1 last1, I2 first2, S2 last2,
+			O result, Comp& comp, Proj1& proj1, Proj2& proj2)
+		{
+			return __stl2::set_symmetric_difference(__stl2::move(first1), __stl2::move(last1),
+				__stl2::move(first2), __stl2::move(last2), __stl2::move(result),
+				__stl2::ref(comp), __stl2::ref(proj1), __stl2::ref(proj2));
+		}
+
+		template <class EP, class I1, class S1, class I2, class S2, class O,
+			class Comp, class Proj1, class Proj2>
+		tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>
+		par(true_type, const EP& pol, I1 first1, S1 last1, I2 first2, S2 last2,
+			O result, Comp& comp, Proj1& proj1, Proj2& proj2)
+		{
+			auto const n1 = static_cast<std::ptrdiff_t>(last1 - first1);
+			auto const n2 = static_cast<std::ptrdiff_t>(last2 - first2);
+			auto const k = detail::parallel_chunk_count(pol, n1 + n2);
+			if (k < 2) {
+				return __set_symmetric_difference::par(false_type{}, pol,
+					__stl2::move(first1), __stl2::move(last1),
+					__stl2::move(first2), __stl2::move(last2),
+					__stl2::move(result), comp, proj1, proj2);
+			}
+
+			result = detail::parallel_set_operation(k, first1, n1, first2, n2,
+				__stl2::move(result), comp, proj1, proj2,
+				[&](I1 f1, I1 l1, I2 f2, I2 l2, auto out) {
+					return __stl2::set_symmetric_difference(f1, l1, f2, l2, __stl2::move(out),
+						__stl2::ref(comp), __stl2::ref(proj1),
+						__stl2::ref(proj2)).out();
+				});
+			return {first1 + n1, first2 + n2, __stl2::move(result)};
+		}
+	}
+
+	// Extension
+	template <class EP, InputIterator I1, Sentinel<I1> S1,
+		InputIterator I2, Sentinel<I2> S2,
+		WeaklyIncrementable O, class Comp = less<>,
+		class Proj1 = identity, class Proj2 = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Mergeable<I1, I2, O, __f<Comp>, __f<Proj1>, __f<Proj2>>
+	tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>
+	set_symmetric_difference(EP&& pol, I1 first1, S1 last1, I2 first2, S2 last2, O result,
+		Comp&& comp_ = Comp{}, Proj1&& proj1_ = Proj1{},
+		Proj2&& proj2_ = Proj2{})
+	{
+		auto comp = ext::make_callable_wrapper(__stl2::forward<Comp>(comp_));
+		auto proj1 = ext::make_callable_wrapper(__stl2::forward<Proj1>(proj1_));
+		auto proj2 = ext::make_callable_wrapper(__stl2::forward<Proj2>(proj2_));
+		return __set_symmetric_difference::par(
+			meta::bool_<detail::parallel_iterator<I1, S1> &&
+				detail::parallel_iterator<I2, S2> &&
+				models::RandomAccessIterator<O>>{},
+			pol, __stl2::move(first1), __stl2::move(last1),
+			__stl2::move(first2), __stl2::move(last2), __stl2::move(result),
+			comp, proj1, proj2);
+	}
+
+	// Extension
+	template <class EP, InputRange Rng1, InputRange Rng2, class O,
+		class Comp = less<>, class Proj1 = identity, class Proj2 = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::WeaklyIncrementable<__f<O>> &&
+		models::Mergeable<
+			iterator_t<Rng1>, iterator_t<Rng2>, __f<O>,
+			__f<Comp>, __f<Proj1>, __f<Proj2>>
+	tagged_tuple<tag::in1(safe_iterator_t<Rng1>),
+		tag::in2(safe_iterator_t<Rng2>), tag::out(__f<O>)>
+	set_symmetric_difference(EP&& pol, Rng1&& rng1, Rng2&& rng2, O&& result, Comp&& comp = Comp{},
+		Proj1&& proj1 = Proj1{}, Proj2&& proj2 = Proj2{})
+	{
+		return __stl2::set_symmetric_difference(__stl2::forward<EP>(pol),
+			__stl2::begin(rng1), __stl2::end(rng1),
+			__stl2::begin(rng2), __stl2::end(rng2),
+			__stl2::forward<O>(result), __stl2::forward<Comp>(comp),
+			__stl2::forward<Proj1>(proj1), __stl2::forward<Proj2>(proj2));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -13,10 +13,16 @@
 #ifndef STL2_DETAIL_ALGORITHM_SHUFFLE_HPP
 #define STL2_DETAIL_ALGORITHM_SHUFFLE_HPP
 
+#include <cstdint>
+#include <memory>
 #include <stl2/iterator.hpp>
 #include <stl2/random.hpp>
+#include <stl2/detail/bounded_rand.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/random_engine.hpp>
 #include <stl2/detail/randutils.hpp>
+#include <stl2/detail/temporary_vector.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/concepts/core.hpp>
 
@@ -24,6 +30,67 @@
 // shuffle [alg.random.shuffle]
 //
 STL2_OPEN_NAMESPACE {
+	namespace __shuffle {
+		template <class I, class S, class Gen, class D>
+		I impl(false_type, I const first, S const last, Gen& g, D*)
+		{
+			auto mid = first;
+			if (mid == last) {
+				return mid;
+			}
+			auto dist = uniform_int_distribution<D>{};
+			using param_t = typename uniform_int_distribution<D>::param_type;
+			while (++mid != last) {
+				if (auto const i = dist(g, param_t{0, mid - first})) {
+					__stl2::iter_swap(mid - i, mid);
+				}
+			}
+			return mid;
+		}
+
+		// Places elements j, ..., j + K - 1 with one batch of K dice, for
+		// each j in [j, n) in steps of K, while the product of the K
+		// bounds fits in 64 bits. Returns the first j not placed.
+		template <std::size_t K, class I, class Gen>
+		difference_type_t<I> roll(I first, difference_type_t<I> j,
+			difference_type_t<I> const n, Gen& g)
+		{
+			constexpr auto k = static_cast<difference_type_t<I>>(K);
+			for (; n - j >= k &&
+				detail::batch_size(static_cast<std::uint64_t>(j) + 1) >= K; j += k)
+			{
+				std::uint64_t bounds[K];
+				std::uint64_t picks[K];
+				for (std::size_t i = 0; i < K; ++i) {
+					bounds[i] = static_cast<std::uint64_t>(j) + i + 1;
+				}
+				ext::bounded_rand_batch(g, bounds, picks);
+				for (std::size_t i = 0; i < K; ++i) {
+					__stl2::iter_swap(first + static_cast<difference_type_t<I>>(picks[i]),
+						first + (j + static_cast<difference_type_t<I>>(i)));
+				}
+			}
+			return j;
+		}
+
+		// Fisher-Yates with Lemire's bounded integers, rolling as many dice
+		// per random word as detail::batch_size allows: six while the
+		// bounds are below 2^10, four below 2^16, three below 2^21 and two
+		// below 2^32.
+		template <class I, class S, class Gen, class D>
+		I impl(true_type, I const first, S const last, Gen& g, D*)
+		{
+			auto const n = __stl2::distance(first, last);
+			difference_type_t<I> j = 1;
+			j = __shuffle::roll<6>(first, j, n, g);
+			j = __shuffle::roll<4>(first, j, n, g);
+			j = __shuffle::roll<3>(first, j, n, g);
+			j = __shuffle::roll<2>(first, j, n, g);
+			j = __shuffle::roll<1>(first, j, n, g);
+			return first + n;
+		}
+	}
+
 	template <RandomAccessIterator I, Sentinel<I> S,
 		class Gen = detail::default_random_engine&, class D = difference_type_t<I>>
 	requires
@@ -32,18 +99,9 @@ STL2_OPEN_NAMESPACE {
 		models::ConvertibleTo<result_of_t<Gen&()>, D>
 	I shuffle(I const first, S const last, Gen&& g = detail::get_random_engine())
 	{
-		auto mid = first;
-		if (mid == last) {
-			return mid;
-		}
-		auto dist = uniform_int_distribution<D>{};
-		using param_t = typename uniform_int_distribution<D>::param_type;
-		while (++mid != last) {
-			if (auto const i = dist(g, param_t{0, mid - first})) {
-				__stl2::iter_swap(mid - i, mid);
-			}
-		}
-		return mid;
+		return __shuffle::impl(
+			meta::bool_<detail::full_width_urng<remove_reference_t<Gen>>>{},
+			first, last, g, static_cast<D*>(nullptr));
 	}
 
 	template <RandomAccessRange Rng, class Gen = detail::default_random_engine&,
@@ -58,6 +116,174 @@ STL2_OPEN_NAMESPACE {
 		return  __stl2::shuffle(__stl2::begin(rng), __stl2::end(rng),
 			__stl2::forward<Gen>(g));
 	}
+
+	namespace __shuffle {
+		// Buckets are sized to stay in a per-core cache while they are
+		// shuffled; there are at most max_buckets of them so that the
+		// scatter does not thrash the TLB.
+		constexpr std::size_t bucket_bytes = std::size_t{1} << 20;
+		constexpr std::ptrdiff_t max_buckets = std::ptrdiff_t{1} << 10;
+
+		// Calls f(i, b) for each i in [lo, hi), where b is a uniform bucket
+		// number in [0, buckets) drawn from eng, four at a time.
+		template <class Engine, class F>
+		void label(Engine& eng, std::ptrdiff_t buckets,
+			std::ptrdiff_t lo, std::ptrdiff_t const hi, F&& f)
+		{
+			auto const b = static_cast<std::uint64_t>(buckets);
+			std::uint64_t const bounds[4] = {b, b, b, b};
+			std::uint64_t picks[4];
+			for (; hi - lo >= 4; lo += 4) {
+				ext::bounded_rand_batch(eng, bounds, picks);
+				for (std::ptrdiff_t i = 0; i < 4; ++i) {
+					f(lo + i, static_cast<std::ptrdiff_t>(picks[i]));
+				}
+			}
+			for (; lo < hi; ++lo) {
+				f(lo, static_cast<std::ptrdiff_t>(ext::bounded_rand(eng, b)));
+			}
+		}
+
+		template <class EP, class I, class S, class Gen>
+		I par(false_type, const EP&, I first, S last, Gen& g)
+		{
+			return __stl2::shuffle(__stl2::move(first), __stl2::move(last), g);
+		}
+
+		// Sanders' bucketed shuffle ("Random Permutations on Distributed,
+		// External and Hierarchical Memory", 1998): every element is sent
+		// to a uniformly random bucket, and each bucket is then shuffled
+		// on its own, which yields a uniform permutation. Each chunk of
+		// the input labels its elements with its own xoshiro256pp stream,
+		// counts them per bucket, and replays the same labels to scatter
+		// them into a temporary buffer; the buckets, which fit in cache,
+		// are then shuffled and moved back concurrently. Without room for
+		// the whole range, or for ranges of only a few buckets, this is the
+		// sequential shuffle.
+		template <class EP, class I, class S, class Gen>
+		I par(true_type, const EP& pol, I first, S last, Gen& g)
+		{
+			using T = value_type_t<I>;
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const per_bucket = static_cast<std::ptrdiff_t>(
+				bucket_bytes / sizeof(T) > 0 ? bucket_bytes / sizeof(T) : 1);
+			if (n / per_bucket < 2) {
+				return __shuffle::par(false_type{}, pol, __stl2::move(first),
+					__stl2::move(last), g);
+			}
+			// Moves into and out of the buffer must not throw: an element
+			// in flight could not be put back.
+			auto buf = is_nothrow_move_constructible<T>::value &&
+				is_nothrow_move_assignable<T>::value
+				? detail::temporary_buffer<T>{n} : detail::temporary_buffer<T>{};
+			if (buf.size() < n) {
+				return __shuffle::par(false_type{}, pol, __stl2::move(first),
+					__stl2::move(last), g);
+			}
+			T* const tmp = buf.data();
+
+			auto const buckets = n / per_bucket < max_buckets
+				? n / per_bucket : max_buckets;
+			auto const k = detail::parallel_chunk_count(pol, n);
+
+			// Chunk c uses the stream c jumps of 2^128 past one seeded with
+			// 256 bits from g, as many as its state holds.
+			auto engines = std::make_unique<ext::xoshiro256pp[]>(k);
+			{
+				auto dist = uniform_int_distribution<std::uint32_t>{};
+				std::uint32_t words[8];
+				for (auto& w : words) {
+					w = dist(g);
+				}
+				seed_seq seq(words, words + 8);
+				engines[0].seed(seq);
+			}
+			for (std::ptrdiff_t c = 1; c < k; ++c) {
+				engines[c] = engines[c - 1];
+				engines[c].jump();
+			}
+
+			// offsets[c * buckets + b] counts, then locates, the elements of
+			// chunk c bound for bucket b; buckets are laid out in order, and
+			// within a bucket the chunks are.
+			auto offsets = std::make_unique<std::ptrdiff_t[]>(k * buckets);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto eng = engines[c];
+				auto* const counts = offsets.get() + c * buckets;
+				__shuffle::label(eng, buckets, detail::chunk_offset(n, k, c),
+					detail::chunk_offset(n, k, c + 1),
+					[counts](std::ptrdiff_t, std::ptrdiff_t b) { ++counts[b]; });
+			});
+			auto bucket_begin = std::make_unique<std::ptrdiff_t[]>(buckets + 1);
+			std::ptrdiff_t sum = 0;
+			for (std::ptrdiff_t b = 0; b < buckets; ++b) {
+				bucket_begin[b] = sum;
+				for (std::ptrdiff_t c = 0; c < k; ++c) {
+					auto const count = offsets[c * buckets + b];
+					offsets[c * buckets + b] = sum;
+					sum += count;
+				}
+			}
+			bucket_begin[buckets] = sum;
+
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto& eng = engines[c];
+				auto* const next = offsets.get() + c * buckets;
+				__shuffle::label(eng, buckets, detail::chunk_offset(n, k, c),
+					detail::chunk_offset(n, k, c + 1),
+					[&](std::ptrdiff_t i, std::ptrdiff_t b) {
+						detail::construct(tmp[next[b]++], __stl2::iter_move(first + i));
+					});
+			});
+
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto& eng = engines[c];
+				auto const hi = detail::chunk_offset(buckets, k, c + 1);
+				for (auto b = detail::chunk_offset(buckets, k, c); b < hi; ++b) {
+					auto const lo = bucket_begin[b];
+					auto const end = bucket_begin[b + 1];
+					__stl2::shuffle(tmp + lo, tmp + end, eng);
+					for (auto i = lo; i < end; ++i) {
+						first[i] = __stl2::move(tmp[i]);
+						detail::destruct(tmp[i]);
+					}
+				}
+			});
+			return first + n;
+		}
+	}
+
+	// Extension: with ext::par, shuffles in cache-sized buckets across
+	// threads. The result is a uniformly random permutation, but not the
+	// one the sequential algorithm would produce from the same generator.
+	template <class EP, RandomAccessIterator I, Sentinel<I> S,
+		class Gen = detail::default_random_engine&>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Permutable<I> &&
+		models::UniformRandomNumberGenerator<remove_reference_t<Gen>> &&
+		models::ConvertibleTo<result_of_t<Gen&()>, difference_type_t<I>>
+	I shuffle(EP&& pol, I first, S last, Gen&& g = detail::get_random_engine())
+	{
+		return __shuffle::par(
+			meta::bool_<detail::parallel_iterator<I, S>>{},
+			pol, __stl2::move(first), __stl2::move(last), g);
+	}
+
+	// Extension
+	template <class EP, RandomAccessRange Rng,
+		class Gen = detail::default_random_engine&>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Permutable<iterator_t<Rng>> &&
+		models::UniformRandomNumberGenerator<remove_reference_t<Gen>> &&
+		models::ConvertibleTo<result_of_t<Gen&()>, difference_type_t<iterator_t<Rng>>>
+	safe_iterator_t<Rng> shuffle(EP&& pol, Rng&& rng,
+		Gen&& g = detail::get_random_engine())
+	{
+		return __stl2::shuffle(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng), __stl2::forward<Gen>(g));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
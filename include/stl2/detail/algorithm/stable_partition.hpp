@@ -15,6 +15,7 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/temporary_vector.hpp>
 #include <stl2/detail/algorithm/find_if_not.hpp>
 #include <stl2/detail/algorithm/move.hpp>
@@ -31,7 +32,7 @@ STL2_OPEN_NAMESPACE {
 	namespace detail {
 		namespace stable_part {
 			Readable{I}
-			using buf_t = detail::temporary_buffer<value_type_t<I>>;
+			using buf_t = detail::scratch_vector<value_type_t<I>>;
 
 			template <ForwardIterator I, class Proj,
 				IndirectCallablePredicate<projected<I, Proj>> Pred>
@@ -57,18 +58,19 @@ STL2_OPEN_NAMESPACE {
 				// Precondition: !pred(proj(*first)))
 				// Precondition: __stl2::next(first) == next
 				STL2_ASSUME(n >= 2);
-				STL2_ASSUME(n <= buf.size());
+				STL2_ASSUME(n <= buf.capacity());
+				STL2_ASSUME(buf.empty());
 
-				auto&& vec = detail::make_temporary_vector(buf);
-				vec.push_back(__stl2::iter_move(first));
+				buf.push_back(__stl2::iter_move(first));
 				auto counted = __stl2::make_counted_iterator(
 					ext::uncounted(next), n - 1);
 				auto pp = __stl2::partition_copy(
 						__stl2::make_move_iterator(__stl2::move(counted)),
 						move_sentinel<default_sentinel>{},
-						__stl2::move(first), __stl2::back_inserter(vec),
+						__stl2::move(first), __stl2::back_inserter(buf),
 						__stl2::ref(pred), __stl2::ref(proj)).out1();
-				auto last = __stl2::move(vec, pp).out();
+				auto last = __stl2::move(buf, pp).out();
+				buf.clear();
 				return {__stl2::move(pp), __stl2::move(last)};
 			}
 
@@ -97,7 +99,7 @@ STL2_OPEN_NAMESPACE {
 				}
 				// n >= 2
 
-				if (n <= buf.size()) {
+				if (buf.try_reserve(n)) {
 					return stable_part::forward_buffer(
 						__stl2::move(first), __stl2::move(middle),
 						n, buf, pred, proj);
@@ -154,23 +156,24 @@ STL2_OPEN_NAMESPACE {
 				// Precondition: pred(proj(*last))
 				// Precondition: n == distance(first, last)
 				STL2_ASSUME(n >= 2);
-				STL2_ASSUME(n <= buf.size());
+				STL2_ASSUME(n <= buf.capacity());
+				STL2_ASSUME(buf.empty());
 
 				// Move the false values into the temporary buffer
 				// and the true values to the front of the sequence.
-				auto&& vec = detail::make_temporary_vector(buf);
-				vec.push_back(__stl2::iter_move(first));
+				buf.push_back(__stl2::iter_move(first));
 				auto middle = __stl2::next(first);
 				middle = __stl2::partition_copy(
 					__stl2::make_move_iterator(__stl2::move(middle)),
 					__stl2::make_move_iterator(last),
 					__stl2::move(first),
-					__stl2::back_inserter(vec),
+					__stl2::back_inserter(buf),
 					__stl2::ref(pred),
 					__stl2::ref(proj)).out1();
 				*middle = __stl2::iter_move(last);
 				++middle;
-				__stl2::move(vec, middle);
+				__stl2::move(buf, middle);
+				buf.clear();
 				return middle;
 			}
 
@@ -205,7 +208,7 @@ STL2_OPEN_NAMESPACE {
 					return last;
 				}
 				// n >= 2
-				if (n <= buf.size()) {
+				if (buf.try_reserve(n)) {
 					return stable_part::bidirectional_buffer(
 						__stl2::move(first), __stl2::move(last),
 						n, buf, pred, proj);
@@ -280,10 +283,7 @@ STL2_OPEN_NAMESPACE {
 			// We now have a reduced range [first, first + n)
 			// *first is known to be false
 
-			// might want to make this a function of trivial assignment
-			static constexpr difference_type_t<I> alloc_threshold = 4;
-			using buf_t = detail::stable_part::buf_t<I>;
-			auto buf = n >= alloc_threshold ? buf_t{n} : buf_t{};
+			detail::stable_part::buf_t<I> buf;
 			return detail::stable_part::forward(
 				first, n, buf, pred, proj).begin();
 		}
@@ -315,10 +315,7 @@ STL2_OPEN_NAMESPACE {
 			// *first is known to be false
 			// *last is known to be true
 
-			// might want to make this a function of trivial assignment
-			static constexpr difference_type_t<I> alloc_threshold = 4;
-			using buf_t = detail::stable_part::buf_t<I>;
-			buf_t buf = n >= alloc_threshold ? buf_t{n} : buf_t{};
+			detail::stable_part::buf_t<I> buf;
 			return detail::stable_part::bidirectional(
 				first, last, n, buf, pred, proj);
 		}
@@ -391,6 +388,162 @@ STL2_OPEN_NAMESPACE {
 			__stl2::begin(rng), __stl2::move(bound.end()), bound.count(),
 			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
 	}
+
+	namespace __stable_partition {
+		template <class EP, class I, class S, class Pred, class Proj>
+		I par(false_type, const EP&, I first, S last, Pred& pred, Proj& proj)
+		{
+			return __stl2::stable_partition(__stl2::move(first), __stl2::move(last),
+				__stl2::ref(pred), __stl2::ref(proj));
+		}
+
+		// Each chunk is stably partitioned on its own thread. With room for
+		// the whole range, every element is then moved straight to its final
+		// position through the buffer. Otherwise adjacent partitioned blocks
+		// are combined pairwise, [T1 F1][T2 F2] -> [T1 T2][F1 F2], by rotating
+		// F1 T2; the rotations of each round run concurrently and share out
+		// the threads.
+		template <class EP, class I, class S, class Pred, class Proj>
+		I par(true_type, const EP& pol, I first, S last, Pred& pred, Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __stable_partition::par(false_type{}, pol, __stl2::move(first),
+					__stl2::move(last), pred, proj);
+			}
+
+			auto begins = std::make_unique<std::ptrdiff_t[]>(k);
+			auto trues = std::make_unique<std::ptrdiff_t[]>(k);
+			detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto const lo = detail::chunk_offset(n, k, c);
+				auto const hi = detail::chunk_offset(n, k, c + 1);
+				begins[c] = lo;
+				trues[c] = ext::stable_partition_n(first + lo, first + hi, hi - lo,
+					__stl2::ref(pred), __stl2::ref(proj)) - (first + lo);
+			});
+
+			// Elements go through the buffer only if neither moving them in
+			// nor assigning them back can throw.
+			using T = value_type_t<I>;
+			auto buf = is_nothrow_move_constructible<T>::value &&
+				is_nothrow_move_assignable<T>::value
+				? detail::temporary_buffer<T>{n} : detail::temporary_buffer<T>{};
+			if (buf.size() >= n) {
+				auto true_pos = std::make_unique<std::ptrdiff_t[]>(k);
+				for (std::ptrdiff_t c = 0; c < k; ++c) {
+					true_pos[c] = trues[c];
+				}
+				auto const t = detail::exclusive_scan_counts(true_pos.get(), k);
+				T* const tmp = buf.data();
+				detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+					auto const hi = detail::chunk_offset(n, k, c + 1);
+					auto src = first + begins[c];
+					auto const mid = src + trues[c];
+					auto dst = tmp + true_pos[c];
+					for (; src != mid; ++src, ++dst) {
+						detail::construct(*dst, __stl2::iter_move(src));
+					}
+					dst = tmp + t + (begins[c] - true_pos[c]);
+					for (auto const end = first + hi; src != end; ++src, ++dst) {
+						detail::construct(*dst, __stl2::iter_move(src));
+					}
+				});
+				detail::parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+					auto const hi = detail::chunk_offset(n, k, c + 1);
+					for (auto i = detail::chunk_offset(n, k, c); i < hi; ++i) {
+						first[i] = __stl2::move(tmp[i]);
+						detail::destruct(tmp[i]);
+					}
+				});
+				return first + t;
+			}
+
+			auto blocks = k;
+			while (blocks > 1) {
+				auto const pairs = blocks / 2;
+				auto const threads = k / pairs;
+				detail::parallel_for_chunks(pairs, [&](std::ptrdiff_t p) {
+					auto const a = 2 * p;
+					auto const b = a + 1;
+					auto const lo = first + (begins[a] + trues[a]);
+					auto const mid = first + begins[b];
+					detail::parallel_rotate(threads, lo, mid, mid + trues[b]);
+				});
+				for (std::ptrdiff_t p = 0; p < pairs; ++p) {
+					begins[p] = begins[2 * p];
+					trues[p] = trues[2 * p] + trues[2 * p + 1];
+				}
+				if (blocks % 2 != 0) {
+					begins[pairs] = begins[blocks - 1];
+					trues[pairs] = trues[blocks - 1];
+				}
+				blocks = (blocks + 1) / 2;
+			}
+			return first + trues[0];
+		}
+	}
+
+	// Extension
+	template <class EP, ForwardIterator I, Sentinel<I> S, class Pred,
+		class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Permutable<I> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<I, __f<Proj>>>
+	I stable_partition(EP&& pol, I first, S last, Pred&& pred_, Proj&& proj_ = Proj{})
+	{
+		auto pred = ext::make_callable_wrapper(__stl2::forward<Pred>(pred_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __stable_partition::par(
+			meta::bool_<detail::parallel_iterator<I, S>>{},
+			pol, __stl2::move(first), __stl2::move(last), pred, proj);
+	}
+
+	// Extension
+	template <class EP, ForwardRange Rng, class Pred, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::Permutable<iterator_t<Rng>> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<iterator_t<Rng>, __f<Proj>>>
+	safe_iterator_t<Rng>
+	stable_partition(EP&& pol, Rng&& rng, Pred&& pred, Proj&& proj = Proj{})
+	{
+		return __stl2::stable_partition(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng),
+			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
+	}
+
+	// Extension: draws the temporary buffer from r.
+	template <ForwardIterator I, Sentinel<I> S, class Pred, class Proj = identity>
+	requires
+		models::Permutable<I> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<I, __f<Proj>>>
+	I stable_partition(ext::scratch_resource& r, I first, S last,
+		Pred&& pred, Proj&& proj = Proj{})
+	{
+		ext::scoped_scratch_resource _{r};
+		return __stl2::stable_partition(__stl2::move(first), __stl2::move(last),
+			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
+	}
+
+	// Extension: draws the temporary buffer from r.
+	template <ForwardRange Rng, class Pred, class Proj = identity>
+	requires
+		models::Permutable<iterator_t<Rng>> &&
+		models::IndirectCallablePredicate<
+			__f<Pred>, projected<iterator_t<Rng>, __f<Proj>>>
+	safe_iterator_t<Rng>
+	stable_partition(ext::scratch_resource& r, Rng&& rng,
+		Pred&& pred, Proj&& proj = Proj{})
+	{
+		ext::scoped_scratch_resource _{r};
+		return __stl2::stable_partition(__stl2::forward<Rng>(rng),
+			__stl2::forward<Pred>(pred), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
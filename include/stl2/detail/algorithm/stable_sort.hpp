@@ -52,7 +52,7 @@ STL2_OPEN_NAMESPACE {
 	namespace detail {
 		namespace ssort {
 			template <class I>
-			using buf_t = temporary_buffer<value_type_t<I>>;
+			using buf_t = scratch_vector<value_type_t<I>>;
 
 			constexpr int merge_sort_chunk_size = 7;
 
@@ -124,18 +124,20 @@ STL2_OPEN_NAMESPACE {
 				if (step_size >= len) {
 					return;
 				}
-				temporary_vector<value_type_t<I>> vec{buf};
-				ssort::merge_sort_loop(first, last, __stl2::back_inserter(vec), step_size, comp, proj);
+				STL2_ASSUME(len <= buf.capacity());
+				STL2_ASSUME(buf.empty());
+				ssort::merge_sort_loop(first, last, __stl2::back_inserter(buf), step_size, comp, proj);
 				step_size *= 2;
 				while (true) {
-					ssort::merge_sort_loop(vec.begin(), vec.end(), first, step_size, comp, proj);
+					ssort::merge_sort_loop(buf.begin(), buf.end(), first, step_size, comp, proj);
 					step_size *= 2;
 					if (step_size >= len) {
-						return;
+						break;
 					}
-					ssort::merge_sort_loop(first, last, vec.begin(), step_size, comp, proj);
+					ssort::merge_sort_loop(first, last, buf.begin(), step_size, comp, proj);
 					step_size *= 2;
 				}
+				buf.clear();
 			}
 
 			template <RandomAccessIterator I, class C, class P>
@@ -145,7 +147,7 @@ STL2_OPEN_NAMESPACE {
 			{
 				auto len = difference_type_t<I>((last - first + 1) / 2);
 				auto middle = first + len;
-				if (len > buf.size()) {
+				if (!buf.try_reserve(len)) {
 					ssort::stable_sort_adaptive(first, middle, buf, comp, proj);
 					ssort::stable_sort_adaptive(middle, last, buf, comp, proj);
 				} else {
@@ -182,11 +184,10 @@ STL2_OPEN_NAMESPACE {
 		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
 		auto last = __stl2::next(first, __stl2::forward<S>(last_));
 		auto len = difference_type_t<I>(last - first);
-		using buf_t = detail::ssort::buf_t<I>;
-		auto buf = len > 256 ? buf_t{len} : buf_t{};
-		if (!buf.size_) {
+		if (len <= 256) {
 			detail::ssort::inplace_stable_sort(first, last, comp, proj);
 		} else {
+			detail::ssort::buf_t<I> buf;
 			detail::ssort::stable_sort_adaptive(first, last, buf, comp, proj);
 		}
 		return last;
@@ -212,6 +213,33 @@ STL2_OPEN_NAMESPACE {
 		return __stl2::stable_sort(__stl2::begin(rng), __stl2::end(rng),
 			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
 	}
+
+	// Extension: draws the temporary buffer from r.
+	template <class I, class S, class Comp = less<>, class Proj = identity>
+	requires
+		models::ForwardIterator<I> &&
+		models::Sentinel<__f<S>, I> &&
+		models::Sortable<I, __f<Comp>, __f<Proj>>
+	I stable_sort(ext::scratch_resource& r, I first, S&& last,
+		Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		ext::scoped_scratch_resource _{r};
+		return __stl2::stable_sort(__stl2::move(first), __stl2::forward<S>(last),
+			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
+
+	// Extension: draws the temporary buffer from r.
+	template <ForwardRange Rng, class Comp = less<>, class Proj = identity>
+	requires
+		models::Sortable<iterator_t<Rng>, __f<Comp>, __f<Proj>>
+	safe_iterator_t<Rng>
+	stable_sort(ext::scratch_resource& r, Rng&& rng,
+		Comp&& comp = Comp{}, Proj&& proj = Proj{})
+	{
+		ext::scoped_scratch_resource _{r};
+		return __stl2::stable_sort(__stl2::forward<Rng>(rng),
+			__stl2::forward<Comp>(comp), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
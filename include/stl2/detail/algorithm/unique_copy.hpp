@@ -14,7 +14,9 @@
 
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
+#include <stl2/detail/execution.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/copy_if.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 
@@ -155,6 +157,80 @@ STL2_OPEN_NAMESPACE {
 			__stl2::forward<R>(comp),
 			__stl2::forward<Proj>(proj));
 	}
+
+	namespace __unique_copy_par {
+		template <class EP, class I, class S, class O, class R, class Proj>
+		tagged_pair<tag::in(I), tag::out(O)>
+		par(false_type, const EP&, I first, S last, O result, R& comp,
+			Proj& proj)
+		{
+			return __stl2::unique_copy(__stl2::move(first), __stl2::move(last),
+				__stl2::move(result), __stl2::ref(comp), __stl2::ref(proj));
+		}
+
+		// Since comp is an equivalence relation, comparing each element to
+		// its predecessor selects the same elements as the sequential
+		// algorithm's comparison against the most recently copied element,
+		// which makes the selection a pure function of the index.
+		template <class EP, class I, class S, class O, class R, class Proj>
+		tagged_pair<tag::in(I), tag::out(O)>
+		par(true_type, const EP& pol, I first, S last, O result, R& comp,
+			Proj& proj)
+		{
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			auto const k = detail::parallel_chunk_count(pol, n);
+			if (k < 2) {
+				return __unique_copy_par::par(false_type{}, pol,
+					__stl2::move(first), __stl2::move(last),
+					__stl2::move(result), comp, proj);
+			}
+			auto keep = [&](std::ptrdiff_t i) -> bool {
+				return i == 0 || !comp(proj(first[i]), proj(first[i - 1]));
+			};
+			result = detail::parallel_copy_if_index(k, first, n,
+				__stl2::move(result), keep);
+			return {first + n, __stl2::move(result)};
+		}
+	}
+
+	// Extension
+	template <class EP, InputIterator I, Sentinel<I> S, WeaklyIncrementable O,
+		class R = equal_to<>, class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		__unique_copy_req<I, O> &&
+		models::IndirectCallableRelation<
+			__f<R>, projected<I, __f<Proj>>>
+	tagged_pair<tag::in(I), tag::out(O)>
+	unique_copy(EP&& pol, I first, S last, O result, R&& comp_ = R{},
+		Proj&& proj_ = Proj{})
+	{
+		auto comp = ext::make_callable_wrapper(__stl2::forward<R>(comp_));
+		auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+		return __unique_copy_par::par(
+			meta::bool_<detail::parallel_iterator<I, S> &&
+				models::RandomAccessIterator<O>>{},
+			pol, __stl2::move(first), __stl2::move(last), __stl2::move(result),
+			comp, proj);
+	}
+
+	// Extension
+	template <class EP, InputRange Rng, class O, class R = equal_to<>,
+		class Proj = identity>
+	requires
+		models::ExecutionPolicy<EP> &&
+		models::WeaklyIncrementable<__f<O>> &&
+		__unique_copy_req<iterator_t<Rng>, __f<O>> &&
+		models::IndirectCallableRelation<
+			__f<R>, projected<iterator_t<Rng>, __f<Proj>>>
+	tagged_pair<tag::in(safe_iterator_t<Rng>), tag::out(__f<O>)>
+	unique_copy(EP&& pol, Rng&& rng, O&& result, R&& comp = R{},
+		Proj&& proj = Proj{})
+	{
+		return __stl2::unique_copy(__stl2::forward<EP>(pol),
+			__stl2::begin(rng), __stl2::end(rng), __stl2::forward<O>(result),
+			__stl2::forward<R>(comp), __stl2::forward<Proj>(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
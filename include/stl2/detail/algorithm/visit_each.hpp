@@ -0,0 +1,224 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_VISIT_EACH_HPP
+#define STL2_DETAIL_ALGORITHM_VISIT_EACH_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include <stl2/iterator.hpp>
+#include <stl2/variant.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/object.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// visit_each [Extension]
+// Calls fun with the active alternative of every variant in [first, last).
+// Visiting the variants one by one, as visit does, takes an indirect
+// call per element whose target changes with the alternative, which
+// branch predictors handle poorly when the alternatives are mixed.
+//
+// visit_each instead takes the variants a block at a time, sorts
+// iterators to them by alternative (a stable counting sort), and visits
+// each alternative's variants in a loop of direct calls, so a block
+// costs one dispatch per alternative it holds. The elements that hold
+// the same alternative are visited in order, but the elements of a
+// block are visited grouped by alternative, in the order of their
+// indices.
+//
+// visit_each_in_order visits the elements in order, dispatching once per
+// run of consecutive elements that hold the same alternative. It needs
+// no storage and accepts a single-pass range.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __visit_each {
+		template <class I, class F>
+		concept bool constraint =
+			__variant::Variant<reference_t<I>> &&
+			__variant::Visitor<F&, reference_t<I>>;
+
+		// Visits the variants in [first_, last_), which all hold the
+		// alternative of *first_.
+		template <class F, class I>
+		struct run_visitor {
+			F& fun_;
+			I first_;
+			I last_;
+
+			template <std::size_t N, class T>
+			void operator()(meta::size_t<N> n, T&&) {
+				for (auto i = first_; i != last_; ++i) {
+					(void)fun_(__variant::v_access::cooked_get(n, *i));
+				}
+			}
+		};
+
+		// As above, for the variants **p for p in [first_, last_).
+		template <class F, class P>
+		struct bucket_visitor {
+			F& fun_;
+			P first_;
+			P last_;
+
+			template <std::size_t N, class T>
+			void operator()(meta::size_t<N> n, T&&) {
+				for (auto p = first_; p != last_; ++p) {
+					(void)fun_(__variant::v_access::cooked_get(n, **p));
+				}
+			}
+		};
+
+		// Visits *first_ and the run of elements after it that hold the
+		// same alternative, and returns the end of the run.
+		template <class F, class I, class S>
+		struct input_run_visitor {
+			F& fun_;
+			I first_;
+			const S& last_;
+
+			template <std::size_t N, class T>
+			I operator()(meta::size_t<N> n, T&& t) {
+				(void)fun_(__stl2::forward<T>(t));
+				while (++first_ != last_ && (*first_).index() == N) {
+					(void)fun_(__variant::v_access::cooked_get(n, *first_));
+				}
+				return __stl2::move(first_);
+			}
+		};
+
+		template <class F, class I, class S>
+		I in_order(false_type, F& fun, I first, const S& last) {
+			while (first != last) {
+				first = __variant::visit_with_index(
+					input_run_visitor<F, I, S>{fun, first, last}, *first);
+			}
+			return first;
+		}
+
+		// Finding the end of each run before visiting it keeps the next
+		// dispatch from waiting on the last one.
+		template <class F, class I, class S>
+		I in_order(true_type, F& fun, I first, const S& last) {
+			while (first != last) {
+				auto const k = (*first).index();
+				auto i = first;
+				while (++i != last && (*i).index() == k) {}
+				__variant::visit_with_index(
+					run_visitor<F, I>{fun, first, i}, *first);
+				first = __stl2::move(i);
+			}
+			return first;
+		}
+
+		template <class F, class I, class S>
+		I in_order(F& fun, I first, const S& last) {
+			return __visit_each::in_order(
+				meta::bool_<models::ForwardIterator<I>>{}, fun,
+				__stl2::move(first), last);
+		}
+
+		// visit_each sorts this many elements at a time, which bounds
+		// its memory and keeps each block in cache while it is visited.
+		constexpr std::ptrdiff_t block = 4096;
+
+		template <std::size_t N, class F, class I, class S>
+		I grouped(F& fun, I first, const S& last, std::vector<I>& sorted) {
+			// offsets[k + 1] counts the elements that hold alternative k.
+			std::array<std::ptrdiff_t, N + 1> offsets{};
+			std::ptrdiff_t n = 0;
+			auto i = first;
+			for (; n < block && i != last; ++i, ++n) {
+				++offsets[(*i).index() + 1];
+			}
+			for (std::size_t k = 0; k < N; ++k) {
+				if (offsets[k + 1] == n) {
+					// All hold alternative k: nothing to sort.
+					__variant::visit_with_index(
+						run_visitor<F, I>{fun, first, i}, *first);
+					return i;
+				}
+				offsets[k + 1] += offsets[k];
+			}
+
+			// Now offsets[k] is where the elements that hold alternative k
+			// start; after the sort, it is where they end.
+			sorted.resize(static_cast<std::size_t>(n));
+			for (auto j = first; j != i; ++j) {
+				sorted[static_cast<std::size_t>(offsets[(*j).index()]++)] = j;
+			}
+			auto p = sorted.data();
+			for (std::size_t k = 0; k < N; ++k) {
+				auto const q = sorted.data() + offsets[k];
+				if (p != q) {
+					__variant::visit_with_index(
+						bucket_visitor<F, I*>{fun, p, q}, **p);
+				}
+				p = q;
+			}
+			return i;
+		}
+	}
+
+	namespace ext {
+		template <ForwardIterator I, Sentinel<I> S, class F>
+		requires
+			__visit_each::constraint<I, __f<F>>
+		tagged_pair<tag::in(I), tag::fun(__f<F>)>
+		visit_each(I first, S last, F&& fun_)
+		{
+			constexpr std::size_t N =
+				__variant::VariantTypes<reference_t<I>>::size();
+			__f<F> fun = __stl2::forward<F>(fun_);
+			std::vector<I> sorted;
+			while (first != last) {
+				first = __visit_each::grouped<N>(fun, __stl2::move(first),
+					last, sorted);
+			}
+			return {__stl2::move(first), __stl2::move(fun)};
+		}
+
+		template <ForwardRange Rng, class F>
+		requires
+			__visit_each::constraint<iterator_t<Rng>, __f<F>>
+		tagged_pair<tag::in(safe_iterator_t<Rng>), tag::fun(__f<F>)>
+		visit_each(Rng&& rng, F&& fun)
+		{
+			return ext::visit_each(__stl2::begin(rng), __stl2::end(rng),
+				__stl2::forward<F>(fun));
+		}
+
+		template <InputIterator I, Sentinel<I> S, class F>
+		requires
+			__visit_each::constraint<I, __f<F>>
+		tagged_pair<tag::in(I), tag::fun(__f<F>)>
+		visit_each_in_order(I first, S last, F&& fun_)
+		{
+			__f<F> fun = __stl2::forward<F>(fun_);
+			auto i = __visit_each::in_order(fun, __stl2::move(first),
+				__stl2::move(last));
+			return {__stl2::move(i), __stl2::move(fun)};
+		}
+
+		template <InputRange Rng, class F>
+		requires
+			__visit_each::constraint<iterator_t<Rng>, __f<F>>
+		tagged_pair<tag::in(safe_iterator_t<Rng>), tag::fun(__f<F>)>
+		visit_each_in_order(Rng&& rng, F&& fun)
+		{
+			return ext::visit_each_in_order(__stl2::begin(rng), __stl2::end(rng),
+				__stl2::forward<F>(fun));
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,139 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_WEIGHTED_SAMPLE_HPP
+#define STL2_DETAIL_ALGORITHM_WEIGHTED_SAMPLE_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/random.hpp>
+#include <stl2/detail/bounded_rand.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/randutils.hpp>
+#include <stl2/detail/algorithm/heap_sift.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/concepts/core.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// weighted_sample [Extension]
+// Copies up to n elements of [first, last) to out[0, n) without
+// replacement, each element chosen with probability proportional to its
+// weight, by Efraimidis and Spirakis' A-Res ("Weighted Random Sampling
+// with a Reservoir", 2006): element i gets the key log(u_i) / w_i for a
+// uniform u_i in (0, 1), and the n largest keys win. A min-heap of the
+// keys in the reservoir makes this one pass over the input, which may be
+// a single-pass range. Elements whose weight is not positive are never
+// chosen. The sample is in no particular order.
+//
+// weighted_sample_with_replacement draws n elements of a random access
+// range independently through an alias_table over the weights.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __weighted_sample {
+		template <class I, class S, class IW, class O, class Gen>
+		concept bool constraint =
+			InputIterator<I>() && Sentinel<S, I>() && InputIterator<IW>() &&
+			RandomAccessIterator<O>() && IndirectlyCopyable<I, O>() &&
+			ConvertibleTo<reference_t<IW>, double>() &&
+			UniformRandomNumberGenerator<remove_reference_t<Gen>>();
+
+		template <class D>
+		struct entry {
+			double key;
+			D slot;
+		};
+	}
+
+	namespace ext {
+		template <class I, class S, class IW, class O,
+			class Gen = detail::default_random_engine&>
+		requires
+			__weighted_sample::constraint<I, S, IW, O, Gen>
+		tagged_pair<tag::in(I), tag::out(O)>
+		weighted_sample(I first, S last, IW weights, O out,
+			difference_type_t<I> n, Gen&& gen = detail::get_random_engine())
+		{
+			using D = difference_type_t<I>;
+			using E = __weighted_sample::entry<D>;
+			if (n <= 0) {
+				return {__stl2::move(first), __stl2::move(out)};
+			}
+
+			// A min-heap on key of the entries for out[0, size).
+			std::vector<E> heap;
+			heap.reserve(static_cast<std::size_t>(n));
+			auto const comp = greater<>{};
+			auto const proj = &E::key;
+			for (; first != last; (void)++first, ++weights) {
+				auto const w = static_cast<double>(*weights);
+				if (!(w > 0)) {
+					continue;
+				}
+				auto const key = std::log(detail::open_unit(gen)) / w;
+				auto const size = static_cast<D>(heap.size());
+				if (size < n) {
+					out[size] = *first;
+					heap.push_back(E{key, size});
+					detail::sift_up_n(heap.begin(), size + 1, comp, proj);
+				} else if (key > heap.front().key) {
+					out[heap.front().slot] = *first;
+					heap.front().key = key;
+					detail::sift_down_n(heap.begin(), n, heap.begin(), comp, proj);
+				}
+			}
+			out += static_cast<D>(heap.size());
+			return {__stl2::move(first), __stl2::move(out)};
+		}
+
+		template <InputRange Rng, InputRange Weights, class O,
+			class Gen = detail::default_random_engine&>
+		requires
+			__weighted_sample::constraint<iterator_t<Rng>, sentinel_t<Rng>,
+				iterator_t<Weights>, O, Gen>
+		tagged_pair<tag::in(safe_iterator_t<Rng>), tag::out(O)>
+		weighted_sample(Rng&& rng, Weights&& weights, O out,
+			difference_type_t<iterator_t<Rng>> n,
+			Gen&& gen = detail::get_random_engine())
+		{
+			return ext::weighted_sample(__stl2::begin(rng), __stl2::end(rng),
+				__stl2::begin(weights), __stl2::move(out), n,
+				__stl2::forward<Gen>(gen));
+		}
+
+		// Pre: weights has as many elements as rng, none negative and at
+		// least one positive.
+		template <RandomAccessRange Rng, InputRange Weights, class O,
+			class Gen = detail::default_random_engine&>
+		requires
+			models::SizedRange<Rng> &&
+			models::WeaklyIncrementable<O> &&
+			models::IndirectlyCopyable<iterator_t<Rng>, O> &&
+			models::ConvertibleTo<reference_t<iterator_t<Weights>>, double> &&
+			models::UniformRandomNumberGenerator<remove_reference_t<Gen>>
+		O weighted_sample_with_replacement(Rng&& rng, Weights&& weights, O out,
+			difference_type_t<iterator_t<Rng>> n,
+			Gen&& gen = detail::get_random_engine())
+		{
+			auto const table = alias_table(weights);
+			STL2_ASSERT(static_cast<std::size_t>(__stl2::distance(rng)) == table.size());
+			auto const first = __stl2::begin(rng);
+			for (; n > 0; --n, ++out) {
+				*out = first[static_cast<difference_type_t<iterator_t<Rng>>>(table(gen))];
+			}
+			return out;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
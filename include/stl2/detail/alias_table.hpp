@@ -0,0 +1,140 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALIAS_TABLE_HPP
+#define STL2_DETAIL_ALIAS_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/bounded_rand.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/concepts/urng.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// alias_table [Extension]
+// Draws index i with probability proportional to the i-th weight, in
+// constant time per draw, by Vose's alias method ("A Linear Algorithm for
+// Generating Random Numbers with a Given Distribution", 1991). Building
+// the table takes linear time; a draw picks a column uniformly and then
+// either keeps it or takes its alias, which costs two random numbers and
+// a single memory access.
+//
+// Unlike discrete_distribution, which searches the cumulative weights,
+// the cost of a draw does not grow with the number of weights.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		class alias_table {
+			struct column {
+				// Keep this column if 53 random bits fall below threshold.
+				std::uint64_t threshold;
+				std::size_t alias;
+			};
+
+			static constexpr std::uint64_t one = std::uint64_t{1} << 53;
+
+			std::vector<column> columns_;
+
+			void build(std::vector<double> p) {
+				auto const n = p.size();
+				double sum = 0;
+				for (auto w : p) {
+					STL2_ASSERT(w >= 0);
+					sum += w;
+				}
+				STL2_ASSERT(n > 0 && sum > 0);
+				columns_.resize(n);
+				std::vector<std::size_t> small, large;
+				for (std::size_t i = 0; i < n; ++i) {
+					p[i] *= static_cast<double>(n) / sum;
+					(p[i] < 1 ? small : large).push_back(i);
+				}
+				while (!small.empty() && !large.empty()) {
+					auto const s = small.back();
+					small.pop_back();
+					auto const l = large.back();
+					columns_[s] = {static_cast<std::uint64_t>(p[s] * one), l};
+					p[l] = (p[l] + p[s]) - 1;
+					if (p[l] < 1) {
+						large.pop_back();
+						small.push_back(l);
+					}
+				}
+				// Whatever remains has probability 1, up to rounding.
+				for (auto i : large) {
+					columns_[i] = {one, i};
+				}
+				for (auto i : small) {
+					columns_[i] = {one, i};
+				}
+			}
+
+		public:
+			using result_type = std::size_t;
+
+			alias_table() = default;
+
+			// Pre: The weights are non-negative, and at least one is positive.
+			template <InputIterator I, Sentinel<I> S>
+			requires
+				models::ConvertibleTo<reference_t<I>, double>
+			alias_table(I first, S last) {
+				std::vector<double> p;
+				for (; first != last; ++first) {
+					p.push_back(static_cast<double>(*first));
+				}
+				build(std::move(p));
+			}
+
+			template <InputRange Rng>
+			requires
+				!models::Same<decay_t<Rng>, alias_table> &&
+				models::ConvertibleTo<reference_t<iterator_t<Rng>>, double>
+			explicit alias_table(Rng&& weights)
+			: alias_table(__stl2::begin(weights), __stl2::end(weights)) {}
+
+			alias_table(std::initializer_list<double> weights)
+			: alias_table(weights.begin(), weights.end()) {}
+
+			// The number of weights.
+			std::size_t size() const noexcept {
+				return columns_.size();
+			}
+
+			static constexpr result_type min() noexcept {
+				return 0;
+			}
+			result_type max() const noexcept {
+				return columns_.size() - 1;
+			}
+
+			template <class Gen>
+			requires
+				models::UniformRandomNumberGenerator<remove_reference_t<Gen>>
+			result_type operator()(Gen&& g) const {
+				STL2_ASSERT(!columns_.empty());
+				auto const i = static_cast<std::size_t>(
+					ext::bounded_rand(g, columns_.size()));
+				auto const& c = columns_[i];
+				return ext::bounded_rand(g, one) < c.threshold ? i : c.alias;
+			}
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,177 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_BOUNDED_RAND_HPP
+#define STL2_DETAIL_BOUNDED_RAND_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/urng.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// bounded_rand [Extension]
+// Uniform integers in [0, bound) by Lemire's nearly divisionless method
+// ("Fast Random Integer Generation in an Interval", 2019): the high half
+// of a 64x64-bit product of a random word and bound is the result, and
+// the low half decides, almost always without dividing, whether the draw
+// must be rejected to avoid bias.
+//
+// bounded_rand_batch draws several such integers from a single random
+// word when the product of their bounds fits in 64 bits (Brackett-
+// Rozinsky and Lemire, "Batched Ranged Random Integer Generation", 2024),
+// which is what lets shuffle and sample spend less than one generator
+// call per element.
+//
+// Both need a generator whose results are uniform over all 32 or all 64
+// bits. Other generators go through uniform_int_distribution.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template <class G>
+		constexpr bool full_width_urng =
+			G::min() == 0 &&
+			(static_cast<std::uint64_t>(G::max()) == ~std::uint64_t{0} ||
+			 static_cast<std::uint64_t>(G::max()) == 0xffffffffu);
+
+		template <class G>
+		requires full_width_urng<G>
+		inline std::uint64_t random_bits64(G& g) {
+			if (static_cast<std::uint64_t>(G::max()) == ~std::uint64_t{0}) {
+				return static_cast<std::uint64_t>(g());
+			}
+			auto const hi = static_cast<std::uint64_t>(g());
+			return (hi << 32) | static_cast<std::uint64_t>(g());
+		}
+
+		// High half of a * b; the low half goes in lo.
+		inline std::uint64_t mul_hi64(std::uint64_t a, std::uint64_t b,
+			std::uint64_t& lo) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			auto const m = static_cast<unsigned __int128>(a) * b;
+			lo = static_cast<std::uint64_t>(m);
+			return static_cast<std::uint64_t>(m >> 64);
+#else
+			auto const al = a & 0xffffffffu, ah = a >> 32;
+			auto const bl = b & 0xffffffffu, bh = b >> 32;
+			auto const ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+			auto const mid = (ll >> 32) + (lh & 0xffffffffu) + (hl & 0xffffffffu);
+			lo = (mid << 32) | (ll & 0xffffffffu);
+			return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+		}
+
+		template <class G>
+		inline std::uint64_t bounded_rand(true_type, G& g, std::uint64_t bound) {
+			std::uint64_t lo;
+			auto hi = detail::mul_hi64(detail::random_bits64(g), bound, lo);
+			if (lo < bound) {
+				auto const threshold = (0 - bound) % bound;
+				while (lo < threshold) {
+					hi = detail::mul_hi64(detail::random_bits64(g), bound, lo);
+				}
+			}
+			return hi;
+		}
+
+		template <class G>
+		inline std::uint64_t bounded_rand(false_type, G& g, std::uint64_t bound) {
+			using dist_t = std::uniform_int_distribution<std::uint64_t>;
+			return dist_t{0, bound - 1}(g);
+		}
+
+		template <std::size_t K, class G>
+		void bounded_rand_batch(true_type, G& g, const std::uint64_t (&bounds)[K],
+			std::uint64_t (&out)[K])
+		{
+			std::uint64_t product = 1;
+			for (auto b : bounds) {
+				product *= b;
+			}
+			auto draw = [&] {
+				auto x = detail::random_bits64(g);
+				for (std::size_t i = 0; i < K; ++i) {
+					out[i] = detail::mul_hi64(x, bounds[i], x);
+				}
+				return x;
+			};
+			auto lo = draw();
+			if (lo < product) {
+				auto const threshold = (0 - product) % product;
+				while (lo < threshold) {
+					lo = draw();
+				}
+			}
+		}
+
+		template <std::size_t K, class G>
+		void bounded_rand_batch(false_type, G& g, const std::uint64_t (&bounds)[K],
+			std::uint64_t (&out)[K])
+		{
+			for (std::size_t i = 0; i < K; ++i) {
+				out[i] = detail::bounded_rand(false_type{}, g, bounds[i]);
+			}
+		}
+	}
+
+	namespace ext {
+		// Returns a uniform integer in [0, bound). Pre: bound > 0.
+		template <class Gen>
+		requires
+			models::UniformRandomNumberGenerator<remove_reference_t<Gen>>
+		std::uint64_t bounded_rand(Gen&& g, std::uint64_t bound) {
+			STL2_ASSERT(bound > 0);
+			return detail::bounded_rand(
+				meta::bool_<detail::full_width_urng<remove_reference_t<Gen>>>{},
+				g, bound);
+		}
+
+		// Sets each out[i] to a uniform integer in [0, bounds[i]), all
+		// independent. Pre: every bounds[i] > 0, and their product does not
+		// exceed 2^64 - 1.
+		template <std::size_t K, class Gen>
+		requires
+			models::UniformRandomNumberGenerator<remove_reference_t<Gen>>
+		void bounded_rand_batch(Gen&& g, const std::uint64_t (&bounds)[K],
+			std::uint64_t (&out)[K])
+		{
+			detail::bounded_rand_batch(
+				meta::bool_<detail::full_width_urng<remove_reference_t<Gen>>>{},
+				g, bounds, out);
+		}
+	}
+
+	namespace detail {
+		// The number of dice, with consecutive bounds starting at bound,
+		// whose product is sure to fit in 64 bits.
+		constexpr std::size_t batch_size(std::uint64_t bound) noexcept {
+			return bound < (std::uint64_t{1} << 10) - 6 ? 6
+				: bound < (std::uint64_t{1} << 16) - 4 ? 4
+				: bound < (std::uint64_t{1} << 21) - 3 ? 3
+				: bound < (std::uint64_t{1} << 32) - 2 ? 2
+				: 1;
+		}
+
+		// Uniform in (0, 1): 53 random bits, offset by half a step, so
+		// that its logarithm is always finite.
+		template <class Gen>
+		double open_unit(Gen& gen) {
+			auto const bits = ext::bounded_rand(gen, std::uint64_t{1} << 53);
+			return (static_cast<double>(bits) + 0.5) / 9007199254740992.0;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
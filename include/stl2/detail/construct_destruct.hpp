@@ -49,6 +49,20 @@ STL2_OPEN_NAMESPACE {
 		namespace {
 			constexpr auto& construct = detail::static_const<construct_fn>::value;
 		}
+
+		// Default-initializes, where construct value-initializes.
+		struct default_construct_fn {
+			DefaultConstructible{T}
+			void operator()(T& t) const
+			noexcept(is_nothrow_default_constructible<T>::value)
+			{
+				::new(static_cast<void*>(&t)) T;
+			}
+		};
+		namespace {
+			constexpr auto& default_construct =
+				detail::static_const<default_construct_fn>::value;
+		}
 	}
 } STL2_CLOSE_NAMESPACE
 
@@ -0,0 +1,215 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_HPP
+#define STL2_DETAIL_EXECUTION_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Execution policies [Extension]
+// Loosely modeled on the Parallelism TS. Algorithms that accept a policy
+// split random-access inputs into contiguous chunks, process each chunk on
+// its own thread, and stitch the per-chunk results together. Other inputs,
+// and inputs too small to be worth splitting, run sequentially.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct sequenced_policy {};
+
+		struct parallel_policy {
+			// Upper bound on the number of threads; 0 means "as many as
+			// the hardware supports."
+			unsigned max_threads = 0;
+			// Minimum number of elements assigned to each thread.
+			std::ptrdiff_t grain_size = std::ptrdiff_t{1} << 14;
+
+			constexpr parallel_policy() = default;
+			constexpr parallel_policy(unsigned threads,
+				std::ptrdiff_t grain = std::ptrdiff_t{1} << 14) noexcept
+			: max_threads{threads}, grain_size{grain > 0 ? grain : 1} {}
+		};
+
+		template <class T>
+		struct is_execution_policy : false_type {};
+		template <>
+		struct is_execution_policy<sequenced_policy> : true_type {};
+		template <>
+		struct is_execution_policy<parallel_policy> : true_type {};
+
+		// Workaround GCC PR66957 by declaring this unnamed namespace inline.
+		inline namespace {
+			constexpr auto& seq = detail::static_const<sequenced_policy>::value;
+			constexpr auto& par = detail::static_const<parallel_policy>::value;
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	// ExecutionPolicy [Extension]
+	//
+	namespace ext {
+		template <class T>
+		concept bool ExecutionPolicy() {
+			return is_execution_policy<decay_t<T>>::value;
+		}
+	}
+
+	namespace models {
+		template <class>
+		constexpr bool ExecutionPolicy = false;
+		__stl2::ext::ExecutionPolicy{T}
+		constexpr bool ExecutionPolicy<T> = true;
+	}
+
+	namespace detail {
+		// Iterator/sentinel pairs that can be split into chunks in O(1).
+		template <class I, class S>
+		constexpr bool parallel_iterator =
+			models::RandomAccessIterator<I> && models::SizedSentinel<S, I>;
+
+		///////////////////////////////////////////////////////////////////////
+		// Chunking
+		//
+		constexpr std::ptrdiff_t
+		parallel_chunk_count(const ext::sequenced_policy&, std::ptrdiff_t) noexcept {
+			return 1;
+		}
+
+		inline std::ptrdiff_t
+		parallel_chunk_count(const ext::parallel_policy& pol, std::ptrdiff_t n) noexcept {
+			STL2_ASSUME(n >= 0);
+			std::ptrdiff_t threads = pol.max_threads;
+			if (threads == 0) {
+				threads = std::thread::hardware_concurrency();
+				if (threads == 0) {
+					threads = 1;
+				}
+			}
+			auto const by_grain = n / pol.grain_size;
+			return by_grain < 1 ? 1 : (by_grain < threads ? by_grain : threads);
+		}
+
+		// Offset of the i-th of k nearly-equal chunks of n elements.
+		constexpr std::ptrdiff_t
+		chunk_offset(std::ptrdiff_t n, std::ptrdiff_t k, std::ptrdiff_t i) noexcept {
+			STL2_ASSUME_CONSTEXPR(0 < k);
+			STL2_ASSUME_CONSTEXPR(0 <= i && i <= k);
+			return i * (n / k) + (i < n % k ? i : n % k);
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		// parallel_for_chunks
+		// Invokes f(i) for each i in [0, k), chunk 0 on the calling thread and
+		// the rest on freshly spawned threads. Blocks until all calls return,
+		// then rethrows the exception from the lowest-numbered chunk that
+		// threw, if any.
+		//
+		template <class F>
+		void parallel_for_chunks(std::ptrdiff_t k, F&& f)
+		{
+			STL2_ASSUME(k > 0);
+			if (k == 1) {
+				f(std::ptrdiff_t{0});
+				return;
+			}
+
+			auto errors = std::make_unique<std::exception_ptr[]>(k);
+			auto guarded = [&f, &errors](std::ptrdiff_t i) noexcept {
+				try {
+					f(i);
+				} catch(...) {
+					errors[i] = std::current_exception();
+				}
+			};
+
+			std::vector<std::thread> workers;
+			workers.reserve(k - 1);
+			try {
+				for (std::ptrdiff_t i = 1; i < k; ++i) {
+					workers.emplace_back(guarded, i);
+				}
+			} catch(...) {
+				// Could not spawn another thread: run the remaining chunks here.
+				for (auto i = static_cast<std::ptrdiff_t>(workers.size()) + 1; i < k; ++i) {
+					guarded(i);
+				}
+			}
+			guarded(0);
+			for (auto& t : workers) {
+				t.join();
+			}
+
+			for (std::ptrdiff_t i = 0; i < k; ++i) {
+				if (errors[i]) {
+					std::rethrow_exception(errors[i]);
+				}
+			}
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		// parallel_find_index
+		// Returns the smallest index in [0, n) at which f reports a hit, or n.
+		// f(lo, hi) must return the first hit in [lo, hi), or hi if there is
+		// none. Each of the k chunks is searched in blocks; a chunk gives up
+		// once an earlier position has been found by some other chunk, so
+		// the work done past the first hit stays bounded.
+		//
+		constexpr std::ptrdiff_t parallel_search_block = std::ptrdiff_t{1} << 12;
+
+		template <class F>
+		std::ptrdiff_t parallel_find_index(std::ptrdiff_t k, std::ptrdiff_t n, F&& f)
+		{
+			STL2_ASSUME(n >= 0);
+			std::atomic<std::ptrdiff_t> found{n};
+			parallel_for_chunks(k, [&](std::ptrdiff_t c) {
+				auto lo = chunk_offset(n, k, c);
+				auto const hi = chunk_offset(n, k, c + 1);
+				while (lo < hi && lo < found.load(std::memory_order_relaxed)) {
+					auto const stop = hi - lo > parallel_search_block
+						? lo + parallel_search_block : hi;
+					auto const i = static_cast<std::ptrdiff_t>(f(lo, stop));
+					if (i != stop) {
+						auto cur = found.load(std::memory_order_relaxed);
+						while (i < cur && !found.compare_exchange_weak(cur, i)) {}
+						return;
+					}
+					lo = stop;
+				}
+			});
+			return found.load();
+		}
+
+		// Replaces counts[0..k) with their exclusive prefix sums and returns
+		// the total.
+		inline std::ptrdiff_t exclusive_scan_counts(std::ptrdiff_t* counts,
+			std::ptrdiff_t k) noexcept
+		{
+			std::ptrdiff_t sum = 0;
+			for (std::ptrdiff_t i = 0; i < k; ++i) {
+				auto const c = counts[i];
+				counts[i] = sum;
+				sum += c;
+			}
+			return sum;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
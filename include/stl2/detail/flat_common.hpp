@@ -0,0 +1,70 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_FLAT_COMMON_HPP
+#define STL2_DETAIL_FLAT_COMMON_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/utility.hpp>
+#include <stl2/detail/fwd.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Pieces shared by flat_set and flat_map [Extension]
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		// Tag for constructors and insert overloads whose input the caller
+		// guarantees is already sorted by the comparison and free of
+		// equivalent keys.
+		struct sorted_unique_t {};
+		namespace {
+			constexpr auto& sorted_unique =
+				detail::static_const<sorted_unique_t>::value;
+		}
+	}
+
+	namespace detail {
+		// Equivalence under a strict weak order, for adjacent elements of a
+		// sorted sequence: x, which precedes y, is equivalent to y unless
+		// comp(x, y).
+		template <class Comp>
+		struct sorted_equivalent {
+			const Comp* comp_;
+
+			template <class T, class U>
+			constexpr bool operator()(T&& x, U&& y) const {
+				return !(*comp_)(__stl2::forward<T>(x), __stl2::forward<U>(y));
+			}
+		};
+
+		// For upper_bound in terms of lower_bound: "x precedes value" is
+		// "not value < x".
+		template <class Comp>
+		struct not_after {
+			const Comp* comp_;
+
+			template <class T, class U>
+			constexpr bool operator()(T&& x, U&& value) const {
+				return !(*comp_)(__stl2::forward<U>(value), __stl2::forward<T>(x));
+			}
+		};
+
+		// Projects a pair, or pair of references, onto its first member.
+		struct pair_first_fn {
+			template <class P>
+			constexpr decltype(auto) operator()(P&& p) const noexcept {
+				return std::get<0>(__stl2::forward<P>(p));
+			}
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
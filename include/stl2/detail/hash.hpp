@@ -13,7 +13,10 @@
 #define STL2_DETAIL_HASH_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <type_traits>
 #include <stl2/detail/fwd.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -39,15 +42,139 @@ STL2_OPEN_NAMESPACE {
 		constexpr bool Hashable<T> = true;
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	// hash_bytes [Extension]
+	// wyhash (final version 4): hashes a block of memory 16 or 48 bytes per
+	// step with 64x64->128-bit multiplies, at several GB/s on long inputs,
+	// with few instructions on short ones.
+	//
+	namespace detail {
+		namespace wyhash {
+			constexpr std::uint64_t secret[4] = {
+				0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+				0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+			};
+
+			inline void mum(std::uint64_t& a, std::uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+				__uint128_t r = a;
+				r *= b;
+				a = static_cast<std::uint64_t>(r);
+				b = static_cast<std::uint64_t>(r >> 64);
+#else
+				auto const ha = a >> 32, hb = b >> 32;
+				auto const la = a & 0xffffffffu, lb = b & 0xffffffffu;
+				auto const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+				auto const t = rl + (rm0 << 32);
+				auto const lo = t + (rm1 << 32);
+				auto const c = (t < rl) + (lo < t);
+				a = lo;
+				b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+			}
+
+			inline std::uint64_t mix(std::uint64_t a, std::uint64_t b) noexcept {
+				mum(a, b);
+				return a ^ b;
+			}
+
+			inline std::uint64_t r8(const unsigned char* p) noexcept {
+				std::uint64_t v;
+				std::memcpy(&v, p, 8);
+				return v;
+			}
+
+			inline std::uint64_t r4(const unsigned char* p) noexcept {
+				std::uint32_t v;
+				std::memcpy(&v, p, 4);
+				return v;
+			}
+
+			inline std::uint64_t r3(const unsigned char* p, std::size_t k) noexcept {
+				return (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[k >> 1]} << 8) | p[k - 1];
+			}
+		}
+
+		// Mixes two 64-bit values into one, for combining hashes.
+		inline std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b) noexcept {
+			return wyhash::mix(a ^ wyhash::secret[0], b ^ wyhash::secret[1]);
+		}
+	}
+
+	namespace ext {
+		inline std::size_t hash_bytes(const void* data, std::size_t len,
+			std::uint64_t seed = 0) noexcept
+		{
+			using namespace detail::wyhash;
+			auto p = static_cast<const unsigned char*>(data);
+			seed ^= mix(seed ^ secret[0], secret[1]);
+			std::uint64_t a, b;
+			if (len <= 16) {
+				if (len >= 4) {
+					a = (r4(p) << 32) | r4(p + ((len >> 3) << 2));
+					b = (r4(p + len - 4) << 32) | r4(p + len - 4 - ((len >> 3) << 2));
+				} else if (len > 0) {
+					a = r3(p, len);
+					b = 0;
+				} else {
+					a = b = 0;
+				}
+			} else {
+				auto i = len;
+				if (i > 48) {
+					auto see1 = seed, see2 = seed;
+					do {
+						seed = mix(r8(p) ^ secret[1], r8(p + 8) ^ seed);
+						see1 = mix(r8(p + 16) ^ secret[2], r8(p + 24) ^ see1);
+						see2 = mix(r8(p + 32) ^ secret[3], r8(p + 40) ^ see2);
+						p += 48;
+						i -= 48;
+					} while (i > 48);
+					seed ^= see1 ^ see2;
+				}
+				while (i > 16) {
+					seed = mix(r8(p) ^ secret[1], r8(p + 8) ^ seed);
+					i -= 16;
+					p += 16;
+				}
+				a = r8(p + i - 16);
+				b = r8(p + i - 8);
+			}
+			a ^= secret[1];
+			b ^= seed;
+			mum(a, b);
+			return static_cast<std::size_t>(mix(a ^ secret[0] ^ len, b ^ secret[1]));
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	// is_trivially_hashable [Extension]
+	// Types whose values are equal exactly when their object representations
+	// are, so that hashing their bytes is a valid hash. By default only the
+	// integral, enumeration and pointer types: a class type's operator==
+	// may ignore some of its members, which a hash of its bytes would not.
+	// Specialize to opt in class types for which the bytes are the value.
+	//
+	namespace ext {
+		template <class T>
+		struct is_trivially_hashable
+		: std::integral_constant<bool,
+			std::is_integral<T>::value || std::is_enum<T>::value ||
+			std::is_pointer<T>::value> {};
+
+		template <class T>
+		constexpr bool is_trivially_hashable_v = is_trivially_hashable<T>::value;
+	}
+
 	///////////////////////////////////////////////////////////////////////////
 	// hash_combine [Extension]
-	// Stolen from Boost.
+	// Folds the hash of v into seed with a full 64-bit multiply-mix.
 	//
 	namespace ext {
 		Hashable{T}
 		inline void hash_combine(std::size_t& seed, const T& v) {
 			std::hash<T> hasher;
-			seed ^= hasher(v) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+			seed = static_cast<std::size_t>(detail::hash_mix(seed, hasher(v)));
 		}
 	}
 } STL2_CLOSE_NAMESPACE
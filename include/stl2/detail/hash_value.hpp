@@ -0,0 +1,315 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_HASH_VALUE_HPP
+#define STL2_DETAIL_HASH_VALUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash.hpp>
+#include <stl2/detail/memory/addressof.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// hash_value and hash_range [Extension]
+//
+// hash_value(t) hashes a single value:
+// * by an ADL-found customization hash_value(t), if there is one;
+// * else, if T is trivially hashable, by hashing its bytes;
+// * else, if T is a contiguous range of trivially hashable elements (e.g.,
+//   std::string), by hashing the bytes of its elements;
+// * else, if T is Hashable, by mixing std::hash<T>;
+// * else, if T is a range, by hash_range.
+//
+// hash_range([first, last), proj) hashes a sequence by folding the
+// hash_value of each projected element through a 64x64-bit multiply-mix,
+// except that a sequence of trivially hashable elements in contiguous
+// storage, with the identity projection, is hashed as a block of bytes,
+// since that is several times faster. The storage counts as contiguous
+// when the iterators model ContiguousIterator or are those of std::vector
+// or std::basic_string, which do not opt in. The range form hashes
+// begin(rng) and end(rng), so it agrees with the iterator form.
+//
+// Equal values of a given type hash equally; the values of two different
+// types need not, though a std::string and a contiguous range of the same
+// chars do. In particular, equal sequences held in contiguous and in
+// non-contiguous storage, e.g. a std::vector and a std::list, need not
+// hash equally.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __hash_value {
+		// Poison pill to keep unqualified lookup from finding ext::hash_value.
+		template <class T> void hash_value(const T&) = delete;
+
+		template <class T>
+		constexpr bool has_customization = false;
+		template <class T>
+		requires
+			requires (const T& t) {
+				{ hash_value(t) } -> std::size_t;
+			}
+		constexpr bool has_customization<T> = true;
+
+		template <class T>
+		constexpr bool trivial = false;
+		template <class T>
+		requires
+			!has_customization<T> && ext::is_trivially_hashable_v<T>
+		constexpr bool trivial<T> = true;
+
+		// Sized random access ranges whose data() points at their elements;
+		// unlike ContiguousRange, this admits std::vector and std::string,
+		// whose iterators do not opt in to ContiguousIterator.
+		template <class R>
+		constexpr bool bytes = false;
+		template <class R>
+		requires
+			models::SizedRange<R> && models::RandomAccessRange<R> &&
+			ext::__contiguous_range<remove_reference_t<R>> &&
+			ext::is_trivially_hashable_v<value_type_t<iterator_t<R>>>
+		constexpr bool bytes<R> = true;
+
+		template <class T>
+		constexpr bool contiguous = false;
+		template <class T>
+		requires
+			!has_customization<T> && !ext::is_trivially_hashable_v<T> &&
+			bytes<const T&>
+		constexpr bool contiguous<T> = true;
+
+		template <class T>
+		constexpr bool std_hash = false;
+		template <class T>
+		requires
+			!has_customization<T> && !ext::is_trivially_hashable_v<T> &&
+			!contiguous<T> && models::Hashable<T>
+		constexpr bool std_hash<T> = true;
+
+		template <class F, class T>
+		constexpr bool has_operator = false;
+		template <class F, class T>
+		requires
+			requires (const F& f, T&& t) {
+				{ f((T&&)t) } -> std::size_t;
+			}
+		constexpr bool has_operator<F, T> = true;
+
+		template <class T>
+		constexpr bool range = false;
+		template <class T>
+		requires
+			!has_customization<T> && !ext::is_trivially_hashable_v<T> &&
+			!contiguous<T> && !models::Hashable<T> && models::InputRange<const T&>
+		constexpr bool range<T> = true;
+
+		template <class I, class S, class Proj>
+		std::size_t fold(I first, S last, Proj& proj);
+
+		// Iterators of the standard containers that store their elements
+		// contiguously but do not opt in to ContiguousIterator.
+		template <class I>
+		constexpr bool std_contiguous = false;
+		template <class I>
+		requires
+			models::Same<I, typename std::vector<value_type_t<I>>::iterator> ||
+			models::Same<I, typename std::vector<value_type_t<I>>::const_iterator> ||
+			models::Same<I, std::string::iterator> ||
+			models::Same<I, std::string::const_iterator> ||
+			models::Same<I, std::wstring::iterator> ||
+			models::Same<I, std::wstring::const_iterator>
+		constexpr bool std_contiguous<I> = true;
+
+		// Sequences that hash_range hashes as a block of bytes. The
+		// reference type rules out std::vector<bool>, whose iterators
+		// std_contiguous would otherwise admit.
+		template <class I, class S, class Proj>
+		constexpr bool byte_sequence = false;
+		template <class I, class S, class Proj>
+		requires
+			models::Same<Proj, identity> && models::SizedSentinel<S, I> &&
+			trivial<value_type_t<I>> &&
+			(models::Same<reference_t<I>, value_type_t<I>&> ||
+			models::Same<reference_t<I>, const value_type_t<I>&>) &&
+			(models::ContiguousIterator<I> || std_contiguous<I>)
+		constexpr bool byte_sequence<I, S, Proj> = true;
+
+		class fn {
+		public:
+			template <class T>
+			requires has_customization<T>
+			std::size_t operator()(const T& t) const
+			STL2_NOEXCEPT_RETURN(
+				static_cast<std::size_t>(hash_value(t))
+			)
+
+			template <class T>
+			requires trivial<T>
+			std::size_t operator()(const T& t) const noexcept {
+				return ext::hash_bytes(&t, sizeof(T));
+			}
+
+			template <class T>
+			requires contiguous<T>
+			std::size_t operator()(const T& t) const noexcept {
+				using V = value_type_t<iterator_t<const T&>>;
+				return ext::hash_bytes(__stl2::data(t),
+					static_cast<std::size_t>(__stl2::size(t)) * sizeof(V));
+			}
+
+			template <class T>
+			requires std_hash<T>
+			std::size_t operator()(const T& t) const
+			noexcept(noexcept(std::hash<T>{}(t)))
+			{
+				return static_cast<std::size_t>(
+					detail::hash_mix(std::hash<T>{}(t), sizeof(T)));
+			}
+
+			template <class T, class F = fn>
+			requires
+				range<T> && has_operator<F, reference_t<iterator_t<const T&>>>
+			std::size_t operator()(const T& t) const {
+				identity proj{};
+				return __hash_value::fold(__stl2::begin(t), __stl2::end(t), proj);
+			}
+		};
+	}
+
+	namespace ext {
+		// Workaround GCC PR66957 by declaring this unnamed namespace inline.
+		inline namespace {
+			constexpr auto& hash_value = detail::static_const<__hash_value::fn>::value;
+		}
+	}
+
+	template <class I, class S, class Proj>
+	std::size_t __hash_value::fold(I first, S last, Proj& proj) {
+		std::uint64_t h = 0;
+		std::uint64_t n = 0;
+		for (; first != last; ++first, ++n) {
+			h = detail::hash_mix(h, ext::hash_value(proj(*first)));
+		}
+		return static_cast<std::size_t>(detail::hash_mix(h, n));
+	}
+
+	namespace __hash_value {
+		template <class I, class S, class Proj>
+		std::size_t sequence(false_type, I first, S last, Proj& proj) {
+			return __hash_value::fold(__stl2::move(first), __stl2::move(last), proj);
+		}
+
+		// As hash_value hashes a contiguous range, so that a std::string
+		// and the same chars passed as a pair of pointers hash equally.
+		template <class I, class S, class Proj>
+		std::size_t sequence(true_type, I first, S last, Proj&) noexcept {
+			auto const n = static_cast<std::size_t>(last - first);
+			return ext::hash_bytes(n ? __stl2::addressof(*first) : nullptr,
+				n * sizeof(value_type_t<I>));
+		}
+	}
+
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////////
+		// HashableValue [Extension]
+		// Types that ext::hash_value accepts.
+		//
+		template <class T>
+		concept bool HashableValue() {
+			return requires (const T& t) {
+				{ ext::hash_value(t) } -> std::size_t;
+			};
+		}
+	}
+
+	namespace models {
+		template <class>
+		constexpr bool HashableValue = false;
+		__stl2::ext::HashableValue{T}
+		constexpr bool HashableValue<T> = true;
+	}
+
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////////
+		// IndirectlyHashable [Extension]
+		// Iterators whose projected values can be copied into a hash table
+		// keyed by hash_value, as the hash-based algorithms do.
+		//
+		template <class I, class Proj = identity>
+		concept bool IndirectlyHashable() {
+			return Readable<I>() &&
+				IndirectRegularCallable<Proj, I>() &&
+				HashableValue<decay_t<reference_t<projected<I, Proj>>>>() &&
+				CopyConstructible<decay_t<reference_t<projected<I, Proj>>>>() &&
+				EqualityComparable<decay_t<reference_t<projected<I, Proj>>>>();
+		}
+	}
+
+	namespace models {
+		template <class I, class Proj = identity>
+		constexpr bool IndirectlyHashable = false;
+		__stl2::ext::IndirectlyHashable{I, Proj}
+		constexpr bool IndirectlyHashable<I, Proj> = true;
+	}
+
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////////
+		// hasher [Extension]
+		// Transparent function object that calls hash_value.
+		//
+		struct hasher {
+			template <class T>
+			requires models::HashableValue<T>
+			std::size_t operator()(const T& t) const
+			noexcept(noexcept(ext::hash_value(t)))
+			{
+				return ext::hash_value(t);
+			}
+
+			using is_transparent = true_type;
+		};
+
+		///////////////////////////////////////////////////////////////////////////
+		// hash_range [Extension]
+		//
+		template <InputIterator I, Sentinel<I> S, class Proj = identity>
+		requires
+			models::HashableValue<decay_t<reference_t<projected<I, __f<Proj>>>>>
+		std::size_t hash_range(I first, S last, Proj&& proj_ = Proj{})
+		{
+			auto proj = ext::make_callable_wrapper(__stl2::forward<Proj>(proj_));
+			return __hash_value::sequence(
+				meta::bool_<__hash_value::byte_sequence<I, S, __f<Proj>>>{},
+				__stl2::move(first), __stl2::move(last), proj);
+		}
+	}
+
+	namespace ext {
+		template <InputRange Rng, class Proj = identity>
+		requires
+			models::HashableValue<
+				decay_t<reference_t<projected<iterator_t<Rng>, __f<Proj>>>>>
+		std::size_t hash_range(Rng&& rng, Proj&& proj = Proj{})
+		{
+			return ext::hash_range(__stl2::begin(rng), __stl2::end(rng),
+				__stl2::forward<Proj>(proj));
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,176 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_HUGE_PAGE_RESOURCE_HPP
+#define STL2_DETAIL_HUGE_PAGE_RESOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/scratch_resource.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define STL2_HAVE_MMAP 1
+#else
+#define STL2_HAVE_MMAP 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// huge_page_scratch_resource [Extension]
+// Backs large temporary buffers with fresh anonymous mappings instead of
+// the heap. Requests of at least threshold bytes are mapped with
+// MAP_HUGETLB where the system has huge pages reserved, and otherwise
+// mapped 2 MiB-aligned and marked MADV_HUGEPAGE so that transparent huge
+// pages can back them; both cut TLB misses on the long sequential sweeps
+// of merging. Smaller requests go to upstream.
+//
+// This is a huge-page resource only: it does not bind pages to NUMA
+// nodes. It hands out new mappings untouched, so each page is placed
+// when it is first written. The parallel stable_partition and
+// inplace_merge fill their buffers in parallel, each worker writing the
+// chunk it then works on, so each page is first touched by a worker that
+// uses it rather than by the thread that allocated the buffer. The
+// workers are not pinned, so a worker that migrates leaves its pages
+// behind.
+//
+// Large requests that cannot be mapped go to upstream too. On systems
+// without mmap every request goes to upstream.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		class huge_page_scratch_resource : public scratch_resource {
+		public:
+			static constexpr std::size_t huge_page_size = std::size_t{1} << 21;
+
+		private:
+			std::size_t threshold_;
+			scratch_resource* upstream_;
+
+			static std::size_t round_up(std::size_t bytes) noexcept {
+				return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+			}
+
+			static bool huge_aligned(const void* p) noexcept {
+				return reinterpret_cast<std::uintptr_t>(p) % huge_page_size == 0;
+			}
+
+			static std::size_t pad(std::size_t alignment) noexcept {
+				STL2_ASSUME(alignment < huge_page_size);
+				return alignment > alignof(std::max_align_t)
+					? alignment : alignof(std::max_align_t);
+			}
+
+			// A large request that cannot be mapped is served by upstream.
+			// Mappings always start on a huge page boundary, so such a block
+			// is handed out at an offset that does not, which do_deallocate
+			// reads back from just before it.
+			void* fallback_allocate(std::size_t bytes, std::size_t alignment) noexcept {
+				auto const a = pad(alignment);
+				auto const q = static_cast<unsigned char*>(
+					upstream_->allocate(bytes + 2 * a, alignment));
+				if (!q) {
+					return nullptr;
+				}
+				auto offset = a;
+				if (huge_aligned(q + offset)) {
+					offset += a;
+				}
+				std::memcpy(q + offset - sizeof(offset), &offset, sizeof(offset));
+				return q + offset;
+			}
+
+			void fallback_deallocate(void* p, std::size_t bytes,
+				std::size_t alignment) noexcept
+			{
+				auto const q = static_cast<unsigned char*>(p);
+				std::size_t offset;
+				std::memcpy(&offset, q - sizeof(offset), sizeof(offset));
+				upstream_->deallocate(q - offset, bytes + 2 * pad(alignment), alignment);
+			}
+
+#if STL2_HAVE_MMAP
+			static void* map(std::size_t length) noexcept {
+#ifdef MAP_HUGETLB
+				void* huge = ::mmap(nullptr, length, PROT_READ | PROT_WRITE,
+					MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+				if (huge != MAP_FAILED) {
+					return huge;
+				}
+#endif
+				// Over-map by a huge page and trim, so that the mapping
+				// starts on a huge page boundary.
+				auto const padded = length + huge_page_size;
+				void* q = ::mmap(nullptr, padded, PROT_READ | PROT_WRITE,
+					MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (q == MAP_FAILED) {
+					return nullptr;
+				}
+				auto const base = reinterpret_cast<std::uintptr_t>(q);
+				auto const aligned = (base + huge_page_size - 1) & ~(huge_page_size - 1);
+				if (aligned != base) {
+					::munmap(q, aligned - base);
+				}
+				auto const tail = base + padded - (aligned + length);
+				if (tail != 0) {
+					::munmap(reinterpret_cast<void*>(aligned + length), tail);
+				}
+				void* p = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+				::madvise(p, length, MADV_HUGEPAGE);
+#endif
+				return p;
+			}
+#endif
+
+		protected:
+			void* do_allocate(std::size_t bytes, std::size_t alignment) noexcept override {
+#if STL2_HAVE_MMAP
+				if (bytes >= threshold_) {
+					auto const length = round_up(bytes);
+					void* p = map(length);
+					return p ? p : fallback_allocate(bytes, alignment);
+				}
+#endif
+				return upstream_->allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* p, std::size_t bytes,
+				std::size_t alignment) noexcept override
+			{
+#if STL2_HAVE_MMAP
+				if (bytes >= threshold_) {
+					if (huge_aligned(p)) {
+						::munmap(p, round_up(bytes));
+					} else {
+						fallback_deallocate(p, bytes, alignment);
+					}
+					return;
+				}
+#endif
+				upstream_->deallocate(p, bytes, alignment);
+			}
+
+		public:
+			explicit huge_page_scratch_resource(
+				std::size_t threshold = huge_page_size,
+				scratch_resource* upstream = new_delete_scratch_resource()) noexcept
+			: threshold_{threshold > 0 ? threshold : 1}, upstream_{upstream} {}
+
+			std::size_t threshold() const noexcept {
+				return threshold_;
+			}
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -13,11 +13,11 @@
 #define STL2_DETAIL_ITERATOR_INSERT_ITERATORS_HPP
 
 #include <cstddef>
-#include <stl2/memory.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/raw_ptr.hpp>
 #include <stl2/detail/iterator/basic_iterator.hpp>
 #include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/memory/addressof.hpp>
 #include <stl2/detail/range/concepts.hpp>
 
 STL2_OPEN_NAMESPACE {
@@ -14,7 +14,6 @@
 
 #include <iosfwd>
 #include <string>
-#include <stl2/memory.hpp>
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/raw_ptr.hpp>
@@ -24,6 +23,7 @@
 #include <stl2/detail/iterator/basic_iterator.hpp>
 #include <stl2/detail/iterator/concepts.hpp>
 #include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/memory/addressof.hpp>
 
 STL2_OPEN_NAMESPACE {
 	namespace detail {
@@ -0,0 +1,47 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_MEMORY_ADDRESSOF_HPP
+#define STL2_DETAIL_MEMORY_ADDRESSOF_HPP
+
+#include <memory>
+#include <stl2/detail/fwd.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// addressof [specialized.addressof]
+//
+STL2_OPEN_NAMESPACE {
+	namespace __addressof {
+		template <class>
+		constexpr bool __user_defined_addressof = false;
+		template <class T>
+		requires
+			requires(T& t) { t.operator&(); } ||
+			requires(T& t) { operator&(t); }
+		constexpr bool __user_defined_addressof<T> = true;
+
+		template <class T>
+		requires __user_defined_addressof<T>
+		T* impl(T& t) noexcept {
+			return std::addressof(t);
+		}
+
+		constexpr auto impl(auto& t) noexcept {
+			return &t;
+		}
+	}
+	template <class T>
+	constexpr T* addressof(T& t) noexcept {
+		return __addressof::impl(t);
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,82 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_MEMORY_CONCEPTS_HPP
+#define STL2_DETAIL_MEMORY_CONCEPTS_HPP
+
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Exposition-only concepts for the specialized memory algorithms
+// [specialized.algorithms]
+// The algorithms construct and destroy objects through the iterators
+// they are given, and must be able to clean up after an exception without
+// themselves throwing: incrementing, comparing and dereferencing these
+// iterators must not throw, and dereferencing must yield an lvalue of the
+// value type.
+//
+STL2_OPEN_NAMESPACE {
+	template <class I>
+	concept bool __NoThrowInputIterator =
+		InputIterator<I>() &&
+		_Is<reference_t<I>, is_lvalue_reference> &&
+		Same<__uncvref<reference_t<I>>, value_type_t<I>>();
+
+	template <class S, class I>
+	concept bool __NoThrowSentinel = Sentinel<S, I>();
+
+	template <class I>
+	concept bool __NoThrowForwardIterator =
+		__NoThrowInputIterator<I> &&
+		ForwardIterator<I>() &&
+		__NoThrowSentinel<I, I>;
+
+	template <class Rng>
+	concept bool __NoThrowInputRange =
+		Range<Rng>() &&
+		__NoThrowInputIterator<iterator_t<Rng>> &&
+		__NoThrowSentinel<sentinel_t<Rng>, iterator_t<Rng>>;
+
+	template <class Rng>
+	concept bool __NoThrowForwardRange =
+		__NoThrowInputRange<Rng> &&
+		__NoThrowForwardIterator<iterator_t<Rng>>;
+
+	namespace detail {
+		// Contiguous destinations whose elements are trivially copyable
+		// objects of the source's value type: the specialized algorithms may
+		// copy these with memcpy/memset rather than element-wise.
+		template <class I, class S, class O>
+		constexpr bool trivially_copyable_range = false;
+		template <class I, class S, class O>
+		requires
+			models::ContiguousIterator<I> &&
+			models::SizedSentinel<S, I> &&
+			models::ContiguousIterator<O> &&
+			models::Same<value_type_t<I>, value_type_t<O>> &&
+			is_trivially_copyable<value_type_t<O>>::value
+		constexpr bool trivially_copyable_range<I, S, O> = true;
+
+		// Contiguous ranges whose elements may be written as raw bytes.
+		template <class I, class S>
+		constexpr bool raw_storage_range = false;
+		template <class I, class S>
+		requires
+			models::ContiguousIterator<I> &&
+			models::SizedSentinel<S, I>
+		constexpr bool raw_storage_range<I, S> = true;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
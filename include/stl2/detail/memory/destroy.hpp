@@ -0,0 +1,77 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_MEMORY_DESTROY_HPP
+#define STL2_DETAIL_MEMORY_DESTROY_HPP
+
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/memory/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// destroy_at, destroy, destroy_n [specialized.destroy]
+// Ranges of trivially destructible objects need no destructor calls; the
+// loops are skipped and only the end position is computed.
+//
+STL2_OPEN_NAMESPACE {
+	template <Destructible T>
+	void destroy_at(T* p) noexcept
+	{
+		detail::destruct(*p);
+	}
+
+	namespace __destroy {
+		template <class I, class S>
+		I impl(true_type, I first, S last) noexcept
+		{
+			return __stl2::next(__stl2::move(first), __stl2::move(last));
+		}
+
+		template <class I, class S>
+		I impl(false_type, I first, S last) noexcept
+		{
+			for (; first != last; ++first) {
+				detail::destruct(*first);
+			}
+			return first;
+		}
+	}
+
+	template <__NoThrowInputIterator I, __NoThrowSentinel<I> S>
+	requires models::Destructible<value_type_t<I>>
+	I destroy(I first, S last) noexcept
+	{
+		return __destroy::impl(
+			is_trivially_destructible<value_type_t<I>>{},
+			__stl2::move(first), __stl2::move(last));
+	}
+
+	template <__NoThrowInputRange Rng>
+	requires models::Destructible<value_type_t<iterator_t<Rng>>>
+	safe_iterator_t<Rng> destroy(Rng&& rng) noexcept
+	{
+		return __stl2::destroy(__stl2::begin(rng), __stl2::end(rng));
+	}
+
+	template <__NoThrowInputIterator I>
+	requires models::Destructible<value_type_t<I>>
+	I destroy_n(I first, difference_type_t<I> n) noexcept
+	{
+		return __stl2::destroy(
+			__stl2::make_counted_iterator(__stl2::move(first), n),
+			default_sentinel{}).base();
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,96 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_MEMORY_RELOCATE_HPP
+#define STL2_DETAIL_MEMORY_RELOCATE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/memory/destroy.hpp>
+#include <stl2/detail/memory/uninitialized_copy.hpp>
+#include <stl2/detail/memory/uninitialized_move.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Relocation [Extension]
+// Relocating an object moves it to new storage and ends the lifetime of
+// the original. For trivially relocatable types that is a memcpy of the
+// object representation, with no constructor or destructor calls. Types
+// that are trivially copyable are trivially relocatable; others, such as
+// a unique_ptr-like handle, can opt in by specializing
+// ext::is_trivially_relocatable.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template <class T>
+		struct is_trivially_relocatable : is_trivially_copyable<T> {};
+
+		template <class T>
+		constexpr bool is_trivially_relocatable_v =
+			is_trivially_relocatable<T>::value;
+	}
+
+	namespace __relocate {
+		template <class T>
+		T* construct_n(true_type, T* first, std::ptrdiff_t n, T* result)
+		noexcept(is_nothrow_move_constructible<T>::value)
+		{
+			return __stl2::uninitialized_move_n(first, n, result).out();
+		}
+
+		template <class T>
+		T* construct_n(false_type, T* first, std::ptrdiff_t n, T* result)
+		{
+			return __stl2::uninitialized_copy_n(first, n, result).out();
+		}
+	}
+
+	namespace detail {
+		// Move unless moving may throw and copying can't, as vector does,
+		// so that a throwing relocation leaves the source intact.
+		template <class T>
+		constexpr bool relocate_by_move =
+			is_nothrow_move_constructible<T>::value ||
+			!is_copy_constructible<T>::value;
+
+		template <class T>
+		constexpr bool nothrow_relocatable =
+			ext::is_trivially_relocatable_v<T> ||
+			is_nothrow_move_constructible<T>::value;
+
+		// Relocates the n objects starting at first into the uninitialized,
+		// non-overlapping storage starting at result; returns the end of
+		// the output. If an exception is thrown nothing has been constructed
+		// in the output, and the source is unchanged unless T is move-only
+		// with a throwing move constructor.
+		template <class T>
+		T* uninitialized_relocate_n(T* first, std::ptrdiff_t n, T* result)
+		noexcept(nothrow_relocatable<T>)
+		{
+			if (n <= 0) {
+				return result;
+			}
+			if (ext::is_trivially_relocatable_v<T>) {
+				std::memcpy(static_cast<void*>(result), static_cast<const void*>(first),
+					static_cast<std::size_t>(n) * sizeof(T));
+				return result + n;
+			}
+			auto const out = __relocate::construct_n(
+				meta::bool_<relocate_by_move<T>>{}, first, n, result);
+			__stl2::destroy_n(first, n);
+			return out;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,79 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_MEMORY_UNINITIALIZED_DEFAULT_CONSTRUCT_HPP
+#define STL2_DETAIL_MEMORY_UNINITIALIZED_DEFAULT_CONSTRUCT_HPP
+
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/memory/concepts.hpp>
+#include <stl2/detail/memory/destroy.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// uninitialized_default_construct, uninitialized_default_construct_n
+// [uninitialized.construct.default]
+// Default-initializing a trivially default constructible type does
+// nothing; only the end position is computed.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __uninitialized_default_construct {
+		template <class I, class S>
+		I impl(true_type, I first, S last) noexcept
+		{
+			return __stl2::next(__stl2::move(first), __stl2::move(last));
+		}
+
+		template <class I, class S>
+		I impl(false_type, I first, S last)
+		{
+			auto const start = first;
+			try {
+				for (; first != last; ++first) {
+					detail::default_construct(*first);
+				}
+			} catch(...) {
+				__stl2::destroy(start, first);
+				throw;
+			}
+			return first;
+		}
+	}
+
+	template <__NoThrowForwardIterator I, __NoThrowSentinel<I> S>
+	requires models::DefaultConstructible<value_type_t<I>>
+	I uninitialized_default_construct(I first, S last)
+	{
+		return __uninitialized_default_construct::impl(
+			is_trivially_default_constructible<value_type_t<I>>{},
+			__stl2::move(first), __stl2::move(last));
+	}
+
+	template <__NoThrowForwardRange Rng>
+	requires models::DefaultConstructible<value_type_t<iterator_t<Rng>>>
+	safe_iterator_t<Rng> uninitialized_default_construct(Rng&& rng)
+	{
+		return __stl2::uninitialized_default_construct(
+			__stl2::begin(rng), __stl2::end(rng));
+	}
+
+	template <__NoThrowForwardIterator I>
+	requires models::DefaultConstructible<value_type_t<I>>
+	I uninitialized_default_construct_n(I first, difference_type_t<I> n)
+	{
+		return __stl2::uninitialized_default_construct(
+			__stl2::make_counted_iterator(__stl2::move(first), n),
+			default_sentinel{}).base();
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
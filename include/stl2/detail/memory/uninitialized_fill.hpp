@@ -0,0 +1,138 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_MEMORY_UNINITIALIZED_FILL_HPP
+#define STL2_DETAIL_MEMORY_UNINITIALIZED_FILL_HPP
+
+#include <cstring>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/memory/addressof.hpp>
+#include <stl2/detail/memory/concepts.hpp>
+#include <stl2/detail/memory/destroy.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// uninitialized_fill, uninitialized_fill_n [uninitialized.fill]
+// Filling a contiguous range of a trivially copyable type with a value
+// whose bytes are all equal - zero, or -1 for the integral types - is a
+// single memset. If a constructor throws, the objects already constructed
+// are destroyed before the exception propagates.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __uninitialized_fill {
+		template <class I, class S, class T>
+		constexpr bool memsettable =
+			detail::raw_storage_range<I, S> &&
+			models::Same<value_type_t<I>, T> &&
+			is_trivially_copyable<T>::value;
+
+		// If every byte of the object representation of t is the same,
+		// stores that byte in b and returns true.
+		template <class T>
+		bool uniform_bytes(const T& t, unsigned char& b) noexcept
+		{
+			unsigned char bytes[sizeof(T)];
+			std::memcpy(bytes, __stl2::addressof(t), sizeof(T));
+			b = bytes[0];
+			for (std::size_t i = 1; i < sizeof(T); ++i) {
+				if (bytes[i] != b) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		template <class I, class S, class T>
+		I loop(I first, S last, const T& x)
+		{
+			auto const start = first;
+			try {
+				for (; first != last; ++first) {
+					detail::construct(*first, x);
+				}
+			} catch(...) {
+				__stl2::destroy(start, first);
+				throw;
+			}
+			return first;
+		}
+
+		template <class I, class S, class T>
+		I impl(false_type, I first, S last, const T& x)
+		{
+			return __uninitialized_fill::loop(
+				__stl2::move(first), __stl2::move(last), x);
+		}
+
+		template <class I, class S, class T>
+		I impl(true_type, I first, S last, const T& x) noexcept
+		{
+			unsigned char b;
+			if (!__uninitialized_fill::uniform_bytes(x, b)) {
+				return __uninitialized_fill::loop(
+					__stl2::move(first), __stl2::move(last), x);
+			}
+			auto const n = last - first;
+			if (n > 0) {
+				std::memset(__stl2::addressof(*first), b,
+					static_cast<std::size_t>(n) * sizeof(T));
+				first += n;
+			}
+			return first;
+		}
+	}
+
+	template <__NoThrowForwardIterator I, __NoThrowSentinel<I> S, class T>
+	requires models::Constructible<value_type_t<I>, const T&>
+	I uninitialized_fill(I first, S last, const T& x)
+	{
+		return __uninitialized_fill::impl(
+			meta::bool_<__uninitialized_fill::memsettable<I, S, T>>{},
+			__stl2::move(first), __stl2::move(last), x);
+	}
+
+	template <__NoThrowForwardRange Rng, class T>
+	requires models::Constructible<value_type_t<iterator_t<Rng>>, const T&>
+	safe_iterator_t<Rng> uninitialized_fill(Rng&& rng, const T& x)
+	{
+		return __stl2::uninitialized_fill(__stl2::begin(rng), __stl2::end(rng), x);
+	}
+
+	namespace __uninitialized_fill {
+		template <class I, class T>
+		I impl_n(true_type, I first, difference_type_t<I> n, const T& x)
+		{
+			return __stl2::uninitialized_fill(first, first + n, x);
+		}
+
+		template <class I, class T>
+		I impl_n(false_type, I first, difference_type_t<I> n, const T& x)
+		{
+			return __stl2::uninitialized_fill(
+				__stl2::make_counted_iterator(__stl2::move(first), n),
+				default_sentinel{}, x).base();
+		}
+	}
+
+	template <__NoThrowForwardIterator I, class T>
+	requires models::Constructible<value_type_t<I>, const T&>
+	I uninitialized_fill_n(I first, difference_type_t<I> n, const T& x)
+	{
+		STL2_ASSUME(n >= 0);
+		return __uninitialized_fill::impl_n(
+			meta::bool_<models::RandomAccessIterator<I>>{},
+			__stl2::move(first), n, x);
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
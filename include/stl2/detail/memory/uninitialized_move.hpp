@@ -0,0 +1,116 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_MEMORY_UNINITIALIZED_MOVE_HPP
+#define STL2_DETAIL_MEMORY_UNINITIALIZED_MOVE_HPP
+
+#include <cstring>
+#include <stl2/iterator.hpp>
+#include <stl2/utility.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/memory/addressof.hpp>
+#include <stl2/detail/memory/concepts.hpp>
+#include <stl2/detail/memory/destroy.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// uninitialized_move, uninitialized_move_n [uninitialized.move]
+// Moves between contiguous ranges of the same trivially copyable type
+// are a single memcpy. If a constructor throws, the objects already
+// constructed are destroyed before the exception propagates.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __uninitialized_move {
+		template <class I, class S, class O>
+		tagged_pair<tag::in(I), tag::out(O)>
+		impl(true_type, I first, S last, O result) noexcept
+		{
+			auto const n = last - first;
+			if (n > 0) {
+				std::memcpy(__stl2::addressof(*result), __stl2::addressof(*first),
+					static_cast<std::size_t>(n) * sizeof(value_type_t<O>));
+				first += n;
+				result += n;
+			}
+			return {__stl2::move(first), __stl2::move(result)};
+		}
+
+		template <class I, class S, class O>
+		tagged_pair<tag::in(I), tag::out(O)>
+		impl(false_type, I first, S last, O result)
+		{
+			auto const start = result;
+			try {
+				for (; first != last; ++first, (void)++result) {
+					detail::construct(*result, __stl2::iter_move(first));
+				}
+			} catch(...) {
+				__stl2::destroy(start, result);
+				throw;
+			}
+			return {__stl2::move(first), __stl2::move(result)};
+		}
+	}
+
+	template <InputIterator I, Sentinel<I> S, __NoThrowForwardIterator O>
+	requires models::Constructible<value_type_t<O>, rvalue_reference_t<I>>
+	tagged_pair<tag::in(I), tag::out(O)>
+	uninitialized_move(I first, S last, O result)
+	{
+		return __uninitialized_move::impl(
+			meta::bool_<detail::trivially_copyable_range<I, S, O>>{},
+			__stl2::move(first), __stl2::move(last), __stl2::move(result));
+	}
+
+	template <InputRange Rng, __NoThrowForwardIterator O>
+	requires models::Constructible<value_type_t<O>, rvalue_reference_t<iterator_t<Rng>>>
+	tagged_pair<tag::in(safe_iterator_t<Rng>), tag::out(O)>
+	uninitialized_move(Rng&& rng, O result)
+	{
+		return __stl2::uninitialized_move(
+			__stl2::begin(rng), __stl2::end(rng), __stl2::move(result));
+	}
+
+	namespace __uninitialized_move {
+		template <class I, class O>
+		tagged_pair<tag::in(I), tag::out(O)>
+		impl_n(true_type, I first, difference_type_t<I> n, O result)
+		{
+			return __stl2::uninitialized_move(first, first + n, __stl2::move(result));
+		}
+
+		template <class I, class O>
+		tagged_pair<tag::in(I), tag::out(O)>
+		impl_n(false_type, I first, difference_type_t<I> n, O result)
+		{
+			auto r = __stl2::uninitialized_move(
+				__stl2::make_counted_iterator(__stl2::ext::uncounted(first), n),
+				default_sentinel{}, __stl2::move(result));
+			return {
+				__stl2::ext::recounted(first, r.in().base(), n),
+				__stl2::move(r.out())
+			};
+		}
+	}
+
+	template <InputIterator I, __NoThrowForwardIterator O>
+	requires models::Constructible<value_type_t<O>, rvalue_reference_t<I>>
+	tagged_pair<tag::in(I), tag::out(O)>
+	uninitialized_move_n(I first, difference_type_t<I> n, O result)
+	{
+		STL2_ASSUME(n >= 0);
+		return __uninitialized_move::impl_n(
+			meta::bool_<models::RandomAccessIterator<I>>{},
+			__stl2::move(first), n, __stl2::move(result));
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,110 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_MEMORY_UNINITIALIZED_VALUE_CONSTRUCT_HPP
+#define STL2_DETAIL_MEMORY_UNINITIALIZED_VALUE_CONSTRUCT_HPP
+
+#include <cstring>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/memory/addressof.hpp>
+#include <stl2/detail/memory/concepts.hpp>
+#include <stl2/detail/memory/destroy.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// uninitialized_value_construct, uninitialized_value_construct_n
+// [uninitialized.construct.value]
+// Value-initialized arithmetic, enumeration and pointer objects are all
+// zero bits, so contiguous ranges of them are cleared with memset.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __uninitialized_value_construct {
+		template <class T>
+		constexpr bool zero_is_value_initialized =
+			is_arithmetic<T>::value || is_enum<T>::value || is_pointer<T>::value;
+
+		template <class I, class S>
+		I impl(true_type, I first, S last) noexcept
+		{
+			auto const n = last - first;
+			if (n > 0) {
+				std::memset(__stl2::addressof(*first), 0,
+					static_cast<std::size_t>(n) * sizeof(value_type_t<I>));
+				first += n;
+			}
+			return first;
+		}
+
+		template <class I, class S>
+		I impl(false_type, I first, S last)
+		{
+			auto const start = first;
+			try {
+				for (; first != last; ++first) {
+					detail::construct(*first);
+				}
+			} catch(...) {
+				__stl2::destroy(start, first);
+				throw;
+			}
+			return first;
+		}
+	}
+
+	template <__NoThrowForwardIterator I, __NoThrowSentinel<I> S>
+	requires models::DefaultConstructible<value_type_t<I>>
+	I uninitialized_value_construct(I first, S last)
+	{
+		return __uninitialized_value_construct::impl(
+			meta::bool_<detail::raw_storage_range<I, S> &&
+				__uninitialized_value_construct::zero_is_value_initialized<
+					value_type_t<I>>>{},
+			__stl2::move(first), __stl2::move(last));
+	}
+
+	template <__NoThrowForwardRange Rng>
+	requires models::DefaultConstructible<value_type_t<iterator_t<Rng>>>
+	safe_iterator_t<Rng> uninitialized_value_construct(Rng&& rng)
+	{
+		return __stl2::uninitialized_value_construct(
+			__stl2::begin(rng), __stl2::end(rng));
+	}
+
+	namespace __uninitialized_value_construct {
+		template <class I>
+		I impl_n(true_type, I first, difference_type_t<I> n)
+		{
+			return __stl2::uninitialized_value_construct(first, first + n);
+		}
+
+		template <class I>
+		I impl_n(false_type, I first, difference_type_t<I> n)
+		{
+			return __stl2::uninitialized_value_construct(
+				__stl2::make_counted_iterator(__stl2::move(first), n),
+				default_sentinel{}).base();
+		}
+	}
+
+	template <__NoThrowForwardIterator I>
+	requires models::DefaultConstructible<value_type_t<I>>
+	I uninitialized_value_construct_n(I first, difference_type_t<I> n)
+	{
+		STL2_ASSUME(n >= 0);
+		return __uninitialized_value_construct::impl_n(
+			meta::bool_<models::RandomAccessIterator<I>>{},
+			__stl2::move(first), n);
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,317 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_RANDOM_ENGINE_HPP
+#define STL2_DETAIL_RANDOM_ENGINE_HPP
+
+#include <cstdint>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Small-state random number engines [Extension]
+//
+// splitmix64, xoshiro256pp and pcg64 model UniformRandomNumberGenerator
+// and are seeded like the standard engines, from an integer or from a seed
+// sequence. Each keeps at most 32 bytes of state (against 2.5 KB for
+// mt19937_64) and produces a 64-bit result in a handful of instructions.
+//
+// For parallel streams, xoshiro256pp and pcg64 can jump ahead 2^128 and
+// 2^192, or 2^64 and 2^96, steps respectively. splitmix64 is a counter,
+// so it can discard any number of steps in constant time.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template <class S>
+		constexpr bool seed_sequence = false;
+		template <class S>
+		requires
+			requires (S& q, std::uint32_t* p) {
+				q.generate(p, p);
+			}
+		constexpr bool seed_sequence<S> = true;
+
+		constexpr std::uint64_t rotl64(std::uint64_t x, int k) noexcept {
+			return (x << k) | (x >> (64 - k));
+		}
+
+		template <class Sseq>
+		std::uint64_t seed_words(Sseq& q, std::uint64_t* out, int n) {
+			std::uint32_t words[8];
+			q.generate(words, words + 2 * n);
+			for (int i = 0; i < n; ++i) {
+				out[i] = (std::uint64_t{words[2 * i + 1]} << 32) | words[2 * i];
+			}
+			return out[0];
+		}
+	}
+
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////////
+		// splitmix64 [Extension]
+		// Steele, Lea and Flood's SplitMix: a Weyl sequence through a 64-bit
+		// finalizer. 8 bytes of state, period 2^64.
+		//
+		class splitmix64 {
+			std::uint64_t state_;
+
+			static constexpr std::uint64_t gamma = 0x9e3779b97f4a7c15ull;
+
+		public:
+			using result_type = std::uint64_t;
+			static constexpr result_type default_seed = 0;
+
+			static constexpr result_type min() noexcept { return 0; }
+			static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+			constexpr splitmix64() noexcept : splitmix64(default_seed) {}
+			explicit constexpr splitmix64(result_type s) noexcept : state_{s} {}
+			template <class Sseq>
+			requires
+				!ConvertibleTo<Sseq, result_type>() && detail::seed_sequence<Sseq>
+			explicit splitmix64(Sseq& q) { seed(q); }
+
+			void seed(result_type s = default_seed) noexcept { state_ = s; }
+			template <class Sseq>
+			requires detail::seed_sequence<Sseq>
+			void seed(Sseq& q) { detail::seed_words(q, &state_, 1); }
+
+			result_type operator()() noexcept {
+				auto z = (state_ += gamma);
+				z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+				z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+				return z ^ (z >> 31);
+			}
+
+			void discard(unsigned long long n) noexcept {
+				state_ += n * gamma;
+			}
+
+			friend bool operator==(const splitmix64& x, const splitmix64& y) noexcept {
+				return x.state_ == y.state_;
+			}
+			friend bool operator!=(const splitmix64& x, const splitmix64& y) noexcept {
+				return !(x == y);
+			}
+		};
+
+		///////////////////////////////////////////////////////////////////////////
+		// xoshiro256pp [Extension]
+		// Blackman and Vigna's xoshiro256++ 1.0: 32 bytes of state, period
+		// 2^256 - 1. Integer seeds are expanded through splitmix64, as its
+		// authors recommend, so that no seed yields the all-zero state.
+		//
+		class xoshiro256pp {
+			std::uint64_t s_[4];
+
+			void jump_(const std::uint64_t (&poly)[4]) noexcept {
+				std::uint64_t t[4] = {0, 0, 0, 0};
+				for (auto p : poly) {
+					for (int b = 0; b < 64; ++b) {
+						if (p & (std::uint64_t{1} << b)) {
+							for (int i = 0; i < 4; ++i) {
+								t[i] ^= s_[i];
+							}
+						}
+						(*this)();
+					}
+				}
+				for (int i = 0; i < 4; ++i) {
+					s_[i] = t[i];
+				}
+			}
+
+		public:
+			using result_type = std::uint64_t;
+			static constexpr result_type default_seed = 0;
+
+			static constexpr result_type min() noexcept { return 0; }
+			static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+			xoshiro256pp() noexcept : xoshiro256pp(default_seed) {}
+			explicit xoshiro256pp(result_type s) noexcept { seed(s); }
+			template <class Sseq>
+			requires
+				!ConvertibleTo<Sseq, result_type>() && detail::seed_sequence<Sseq>
+			explicit xoshiro256pp(Sseq& q) { seed(q); }
+
+			void seed(result_type s = default_seed) noexcept {
+				splitmix64 sm{s};
+				for (auto& w : s_) {
+					w = sm();
+				}
+			}
+			template <class Sseq>
+			requires detail::seed_sequence<Sseq>
+			void seed(Sseq& q) {
+				detail::seed_words(q, s_, 4);
+				if ((s_[0] | s_[1] | s_[2] | s_[3]) == 0) {
+					s_[0] = 1;
+				}
+			}
+
+			result_type operator()() noexcept {
+				auto const result = detail::rotl64(s_[0] + s_[3], 23) + s_[0];
+				auto const t = s_[1] << 17;
+				s_[2] ^= s_[0];
+				s_[3] ^= s_[1];
+				s_[1] ^= s_[2];
+				s_[0] ^= s_[3];
+				s_[2] ^= t;
+				s_[3] = detail::rotl64(s_[3], 45);
+				return result;
+			}
+
+			void discard(unsigned long long n) noexcept {
+				for (; n > 0; --n) {
+					(*this)();
+				}
+			}
+
+			// Advances the state by 2^128 steps: 2^128 non-overlapping streams.
+			void jump() noexcept {
+				static constexpr std::uint64_t poly[4] = {
+					0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+					0xa9582618e03fc9aaull, 0x39abdc4529b1661cull
+				};
+				jump_(poly);
+			}
+
+			// Advances the state by 2^192 steps: 2^64 starting points, each
+			// of which can be jump()ed 2^64 times.
+			void long_jump() noexcept {
+				static constexpr std::uint64_t poly[4] = {
+					0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull,
+					0x77710069854ee241ull, 0x39109bb02acbe635ull
+				};
+				jump_(poly);
+			}
+
+			friend bool operator==(const xoshiro256pp& x, const xoshiro256pp& y) noexcept {
+				return x.s_[0] == y.s_[0] && x.s_[1] == y.s_[1] &&
+					x.s_[2] == y.s_[2] && x.s_[3] == y.s_[3];
+			}
+			friend bool operator!=(const xoshiro256pp& x, const xoshiro256pp& y) noexcept {
+				return !(x == y);
+			}
+		};
+
+#if defined(__SIZEOF_INT128__)
+		///////////////////////////////////////////////////////////////////////////
+		// pcg64 [Extension]
+		// O'Neill's PCG XSL RR 128/64: a 128-bit LCG whose high and low halves
+		// are folded and randomly rotated into the output. 32 bytes of state,
+		// period 2^128, and 2^127 streams selected by the increment. Given
+		// the same seed and stream, agrees with pcg64 in the reference
+		// implementation.
+		//
+		class pcg64 {
+			using state_type = unsigned __int128;
+
+			static constexpr state_type multiplier =
+				(state_type{2549297995355413924ull} << 64) | 4865540595714422341ull;
+			static constexpr state_type default_increment =
+				(state_type{6364136223846793005ull} << 64) | 1442695040888963407ull;
+
+			state_type state_;
+			state_type inc_;
+
+			void step() noexcept {
+				state_ = state_ * multiplier + inc_;
+			}
+
+			void seed_(state_type s, state_type inc) noexcept {
+				inc_ = inc | 1;
+				state_ = s + inc_;
+				step();
+			}
+
+		public:
+			using result_type = std::uint64_t;
+			static constexpr result_type default_seed = 0xcafef00dd15ea5e5ull;
+
+			static constexpr result_type min() noexcept { return 0; }
+			static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+			pcg64() noexcept : pcg64(default_seed) {}
+			explicit pcg64(result_type s) noexcept { seed(s); }
+			// Seeds stream number stream; distinct streams do not overlap.
+			pcg64(result_type s, result_type stream) noexcept {
+				seed_(s, state_type{stream} << 1);
+			}
+			template <class Sseq>
+			requires
+				!ConvertibleTo<Sseq, result_type>() && detail::seed_sequence<Sseq>
+			explicit pcg64(Sseq& q) { seed(q); }
+
+			void seed(result_type s = default_seed) noexcept {
+				seed_(s, default_increment);
+			}
+			template <class Sseq>
+			requires detail::seed_sequence<Sseq>
+			void seed(Sseq& q) {
+				std::uint64_t w[4];
+				detail::seed_words(q, w, 4);
+				seed_((state_type{w[0]} << 64) | w[1],
+					((state_type{w[2]} << 64) | w[3]) << 1);
+			}
+
+			result_type operator()() noexcept {
+				step();
+				auto const x = static_cast<std::uint64_t>(state_ >> 64) ^
+					static_cast<std::uint64_t>(state_);
+				auto const rot = static_cast<int>(state_ >> 122);
+				return (x >> rot) | (x << ((-rot) & 63));
+			}
+
+			// Advances the state by delta steps in O(log delta) time (Brown,
+			// "Random Number Generation with Arbitrary Strides", 1994).
+			void advance(state_type delta) noexcept {
+				state_type acc_mult = 1, acc_plus = 0;
+				state_type cur_mult = multiplier, cur_plus = inc_;
+				for (; delta > 0; delta >>= 1) {
+					if (delta & 1) {
+						acc_mult *= cur_mult;
+						acc_plus = acc_plus * cur_mult + cur_plus;
+					}
+					cur_plus = (cur_mult + 1) * cur_plus;
+					cur_mult *= cur_mult;
+				}
+				state_ = acc_mult * state_ + acc_plus;
+			}
+
+			void discard(unsigned long long n) noexcept {
+				advance(n);
+			}
+
+			// Advances the state by 2^64 steps.
+			void jump() noexcept {
+				advance(state_type{1} << 64);
+			}
+
+			// Advances the state by 2^96 steps.
+			void long_jump() noexcept {
+				advance(state_type{1} << 96);
+			}
+
+			friend bool operator==(const pcg64& x, const pcg64& y) noexcept {
+				return x.state_ == y.state_ && x.inc_ == y.inc_;
+			}
+			friend bool operator!=(const pcg64& x, const pcg64& y) noexcept {
+				return !(x == y);
+			}
+		};
+#endif
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -48,6 +48,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <initializer_list>
+#include <mutex>
 #include <thread>
 #include <typeinfo>
 #include <stl2/random.hpp>
@@ -464,13 +465,129 @@ STL2_OPEN_NAMESPACE {
 			using auto_seed_256 = auto_seeded<seed_seq_fe256>;
 		}
 
+		// The engine behind get_random_engine, and so the default for shuffle
+		// and sample. Define STL2_DEFAULT_RANDOM_ENGINE to an engine type,
+		// e.g. ext::xoshiro256pp, to replace the Mersenne Twister.
+#ifdef STL2_DEFAULT_RANDOM_ENGINE
+		using default_random_engine = STL2_DEFAULT_RANDOM_ENGINE;
+#else
 		using default_random_engine =
 			meta::if_c<sizeof(void*) >= 8, __stl2::mt19937_64, __stl2::mt19937>;
+#endif
+
+		namespace randutils {
+			// The seeds of the engines behind get_random_engine. Gathering
+			// entropy takes a random_device read and several system calls, so
+			// it happens once per process; each thread then seeds its engine
+			// from a seed_seq_fe256 over that root and the thread's index.
+			template <class = void>
+			struct engine_seeds {
+				using root_type = std::array<std::uint32_t, 8>;
+				using seeds_type = std::array<std::uint32_t, 10>;
+
+				static std::mutex mutex;
+				// root, rooted and next_thread are guarded by mutex.
+				static root_type root;
+				static bool rooted;
+				static std::uint64_t next_thread;
+				// Bumped by every reseed, so that threads know to reseed too.
+				static std::atomic<std::uint32_t> epoch;
+
+				// The seeds of the next thread to need them, which first sees
+				// epoch e.
+				static seeds_type next(std::uint32_t& e) {
+					std::lock_guard<std::mutex> lock{mutex};
+					if (!rooted) {
+						auto_seed_256{}.generate(root.begin(), root.end());
+						rooted = true;
+					}
+					e = epoch.load(std::memory_order_relaxed);
+					auto const i = next_thread++;
+					seeds_type seeds;
+					__stl2::copy(root, seeds.begin());
+					seeds[8] = static_cast<std::uint32_t>(i);
+					seeds[9] = static_cast<std::uint32_t>(i >> 32);
+					return seeds;
+				}
+
+				// Replaces the root, or draws a fresh one if r is null, and
+				// starts counting threads from zero.
+				static void reseed(const root_type* r) {
+					std::lock_guard<std::mutex> lock{mutex};
+					if (r) {
+						root = *r;
+					} else {
+						auto_seed_256{}.generate(root.begin(), root.end());
+					}
+					rooted = true;
+					next_thread = 0;
+					epoch.fetch_add(1, std::memory_order_relaxed);
+				}
+			};
+
+			template <class T>
+			std::mutex engine_seeds<T>::mutex;
+			template <class T>
+			typename engine_seeds<T>::root_type engine_seeds<T>::root;
+			template <class T>
+			bool engine_seeds<T>::rooted = false;
+			template <class T>
+			std::uint64_t engine_seeds<T>::next_thread = 0;
+			template <class T>
+			std::atomic<std::uint32_t> engine_seeds<T>::epoch{0};
+
+			struct thread_engine {
+				std::uint32_t epoch;
+				default_random_engine engine;
+
+				thread_engine() : engine{make(epoch)} {}
+
+				void reseed() {
+					auto const seeds = engine_seeds<>::next(epoch);
+					seed_seq_fe256 seq(seeds.begin(), seeds.end());
+					engine.seed(seq);
+				}
+
+			private:
+				static default_random_engine make(std::uint32_t& e) {
+					auto const seeds = engine_seeds<>::next(e);
+					seed_seq_fe256 seq(seeds.begin(), seeds.end());
+					return default_random_engine{seq};
+				}
+			};
+		}
+
 		inline default_random_engine& get_random_engine()
 		{
-			thread_local default_random_engine engine{
-				randutils::auto_seed_256{}.base()};
-			return engine;
+			thread_local randutils::thread_engine te;
+			if (te.epoch != randutils::engine_seeds<>::epoch.load(
+				std::memory_order_relaxed)) {
+				te.reseed();
+			}
+			return te.engine;
+		}
+	}
+
+	namespace ext {
+		// Reseeds the engines behind get_random_engine from seed, for
+		// reproducible runs: the calling thread's engine now, and every
+		// other thread's at its next use, in the order of those uses.
+		// Results are reproducible when that order is, e.g. when threads
+		// are started after the call and each is joined before the next.
+		inline void seed_random_engine(std::uint64_t seed) {
+			detail::randutils::seed_seq_fe256 seq{
+				static_cast<std::uint32_t>(seed),
+				static_cast<std::uint32_t>(seed >> 32)};
+			detail::randutils::engine_seeds<>::root_type root;
+			seq.generate(root.begin(), root.end());
+			detail::randutils::engine_seeds<>::reseed(&root);
+			detail::get_random_engine();
+		}
+
+		// As above, but from fresh entropy: undoes seed_random_engine(seed).
+		inline void seed_random_engine() {
+			detail::randutils::engine_seeds<>::reseed(nullptr);
+			detail::get_random_engine();
 		}
 	}
 } STL2_CLOSE_NAMESPACE
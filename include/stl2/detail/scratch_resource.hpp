@@ -0,0 +1,437 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_SCRATCH_RESOURCE_HPP
+#define STL2_DETAIL_SCRATCH_RESOURCE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stl2/utility.hpp>
+#include <stl2/detail/fwd.hpp>
+
+#ifndef STL2_SCRATCH_CACHE
+#define STL2_SCRATCH_CACHE 0
+#endif
+
+#ifndef STL2_SCRATCH_CACHE_LIMIT
+#define STL2_SCRATCH_CACHE_LIMIT (std::size_t{64} << 20)
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Scratch memory resources [Extension]
+// Where the temporary buffers of stable_sort, stable_partition,
+// inplace_merge and friends come from. Each thread has a default resource,
+// initially new_delete_scratch_resource(); algorithms draw from the calling
+// thread's default, which scoped_scratch_resource (or the overloads that
+// take a scratch_resource&) can replace for a while with an arena.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		struct scratch_access;
+	}
+
+	namespace ext {
+		struct scratch_stats {
+			// Number of temporary buffers requested
+			std::size_t requests = 0;
+			// Total size of those requests
+			std::size_t bytes_requested = 0;
+			// Total size of the buffers actually handed out
+			std::size_t bytes_allocated = 0;
+			// Requests that were satisfied only in part, or not at all,
+			// forcing the algorithm onto a slower path
+			std::size_t fallbacks = 0;
+		};
+
+		class scratch_resource {
+			std::atomic<std::size_t> requests_{0};
+			std::atomic<std::size_t> bytes_requested_{0};
+			std::atomic<std::size_t> bytes_allocated_{0};
+			std::atomic<std::size_t> fallbacks_{0};
+
+			friend detail::scratch_access;
+
+		public:
+			scratch_resource() = default;
+			scratch_resource(const scratch_resource&) = delete;
+			scratch_resource& operator=(const scratch_resource&) = delete;
+			virtual ~scratch_resource() = default;
+
+			// Returns at least bytes bytes of storage aligned to alignment,
+			// or nullptr.
+			void* allocate(std::size_t bytes,
+				std::size_t alignment = alignof(std::max_align_t)) noexcept
+			{
+				return do_allocate(bytes, alignment);
+			}
+
+			void deallocate(void* p, std::size_t bytes,
+				std::size_t alignment = alignof(std::max_align_t)) noexcept
+			{
+				do_deallocate(p, bytes, alignment);
+			}
+
+			scratch_stats stats() const noexcept {
+				scratch_stats s;
+				s.requests = requests_.load(std::memory_order_relaxed);
+				s.bytes_requested = bytes_requested_.load(std::memory_order_relaxed);
+				s.bytes_allocated = bytes_allocated_.load(std::memory_order_relaxed);
+				s.fallbacks = fallbacks_.load(std::memory_order_relaxed);
+				return s;
+			}
+
+			void reset_stats() noexcept {
+				requests_.store(0, std::memory_order_relaxed);
+				bytes_requested_.store(0, std::memory_order_relaxed);
+				bytes_allocated_.store(0, std::memory_order_relaxed);
+				fallbacks_.store(0, std::memory_order_relaxed);
+			}
+
+		protected:
+			virtual void* do_allocate(std::size_t bytes, std::size_t alignment) noexcept = 0;
+			virtual void do_deallocate(void* p, std::size_t bytes,
+				std::size_t alignment) noexcept = 0;
+		};
+
+		///////////////////////////////////////////////////////////////////////
+		// new_delete_scratch_resource
+		// The global heap, via nothrow operator new. Thread-safe.
+		//
+		namespace __scratch {
+			class new_delete_resource final : public scratch_resource {
+				void* do_allocate(std::size_t bytes, std::size_t alignment) noexcept override {
+					STL2_ASSUME(alignment <= alignof(std::max_align_t));
+					(void)alignment;
+					return ::operator new(bytes, std::nothrow);
+				}
+
+				void do_deallocate(void* p, std::size_t, std::size_t) noexcept override {
+					::operator delete(p);
+				}
+			};
+		}
+
+		inline scratch_resource* new_delete_scratch_resource() noexcept {
+			static __scratch::new_delete_resource resource;
+			return &resource;
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		// monotonic_scratch_resource
+		// Carves allocations out of a caller-supplied buffer. Freeing the most
+		// recent allocation gives its space back, so the nested, last-in
+		// first-out buffers of the sorting algorithms reuse the arena; other
+		// frees are ignored until release(). Requests that don't fit go to
+		// upstream, if there is one, and fail otherwise. Not thread-safe.
+		//
+		class monotonic_scratch_resource : public scratch_resource {
+			unsigned char* begin_;
+			unsigned char* end_;
+			unsigned char* top_;
+			scratch_resource* upstream_;
+
+			bool owns(void* p) const noexcept {
+				auto const addr = reinterpret_cast<std::uintptr_t>(p);
+				return reinterpret_cast<std::uintptr_t>(begin_) <= addr &&
+					addr < reinterpret_cast<std::uintptr_t>(end_);
+			}
+
+			// Sizes are rounded up so that top_ stays suitably aligned for
+			// any object; only over-aligned requests leave padding behind.
+			static std::size_t round_up(std::size_t bytes) noexcept {
+				constexpr std::size_t a = alignof(std::max_align_t);
+				return (bytes + a - 1) & ~(a - 1);
+			}
+
+		protected:
+			void* do_allocate(std::size_t bytes, std::size_t alignment) noexcept override {
+				void* p = top_;
+				std::size_t space = end_ - top_;
+				if (bytes <= space &&
+					std::align(alignment, round_up(bytes), p, space)) {
+					top_ = static_cast<unsigned char*>(p) + round_up(bytes);
+					return p;
+				}
+				return upstream_ ? upstream_->allocate(bytes, alignment) : nullptr;
+			}
+
+			void do_deallocate(void* p, std::size_t bytes,
+				std::size_t alignment) noexcept override
+			{
+				if (!owns(p)) {
+					upstream_->deallocate(p, bytes, alignment);
+				} else if (static_cast<unsigned char*>(p) + round_up(bytes) == top_) {
+					top_ = static_cast<unsigned char*>(p);
+				}
+			}
+
+		public:
+			monotonic_scratch_resource(void* buffer, std::size_t size,
+				scratch_resource* upstream = nullptr) noexcept
+			: begin_{static_cast<unsigned char*>(buffer)}, end_{begin_ + size}
+			, top_{begin_}, upstream_{upstream} {}
+
+			// Makes the whole buffer available again. Requires: nothing
+			// allocated from the buffer is still in use.
+			void release() noexcept {
+				top_ = begin_;
+			}
+
+			std::size_t bytes_in_use() const noexcept {
+				return top_ - begin_;
+			}
+		};
+
+		///////////////////////////////////////////////////////////////////////
+		// pool_scratch_resource
+		// Keeps freed blocks on free lists by power-of-two size class and
+		// hands them out again, so repeated requests of similar sizes stop
+		// reaching upstream. At most limit() bytes are kept; blocks freed
+		// beyond that go straight back upstream, as do all cached blocks on
+		// release() or destruction. Not thread-safe.
+		//
+		class pool_scratch_resource : public scratch_resource {
+		public:
+			static constexpr std::size_t min_block = 64;
+			static constexpr int size_classes = 8 * sizeof(std::size_t);
+
+		private:
+			struct node {
+				node* next;
+			};
+
+			scratch_resource* upstream_;
+			std::size_t limit_;
+			std::size_t cached_ = 0;
+			node* free_[size_classes] = {};
+
+			static int size_class(std::size_t bytes) noexcept {
+				int c = 0;
+				while ((min_block << c) < bytes) {
+					++c;
+				}
+				return c;
+			}
+
+		protected:
+			void* do_allocate(std::size_t bytes, std::size_t alignment) noexcept override {
+				STL2_ASSUME(alignment <= alignof(std::max_align_t));
+				if (bytes > (std::size_t{1} << (size_classes - 1))) {
+					return nullptr;
+				}
+				auto const c = size_class(bytes);
+				if (node* n = free_[c]) {
+					free_[c] = n->next;
+					cached_ -= min_block << c;
+					return n;
+				}
+				return upstream_->allocate(min_block << c, alignment);
+			}
+
+			void do_deallocate(void* p, std::size_t bytes, std::size_t) noexcept override {
+				auto const c = size_class(bytes);
+				auto const block = min_block << c;
+				if (block > limit_) {
+					upstream_->deallocate(p, block);
+					return;
+				}
+				if (cached_ > limit_ - block) {
+					// Make room for the most recently freed block, which is
+					// the one most likely to be asked for again.
+					trim(limit_ - block);
+				}
+				free_[c] = ::new (p) node{free_[c]};
+				cached_ += block;
+			}
+
+		public:
+			explicit pool_scratch_resource(
+				scratch_resource* upstream = new_delete_scratch_resource(),
+				std::size_t limit = ~std::size_t{0}) noexcept
+			: upstream_{upstream}, limit_{limit} {}
+
+			~pool_scratch_resource() {
+				release();
+			}
+
+			std::size_t limit() const noexcept {
+				return limit_;
+			}
+
+			// Changes the number of bytes kept, trimming the cache to fit.
+			void set_limit(std::size_t bytes) noexcept {
+				limit_ = bytes;
+				trim(bytes);
+			}
+
+			std::size_t cached_bytes() const noexcept {
+				return cached_;
+			}
+
+			// Returns cached blocks to upstream, largest first, until no more
+			// than bytes bytes remain cached. Returns the bytes still cached.
+			std::size_t trim(std::size_t bytes = 0) noexcept {
+				for (int c = size_classes; c-- > 0 && cached_ > bytes;) {
+					while (cached_ > bytes && free_[c]) {
+						node* n = free_[c];
+						free_[c] = n->next;
+						cached_ -= min_block << c;
+						upstream_->deallocate(n, min_block << c);
+					}
+				}
+				return cached_;
+			}
+
+			// Returns all cached blocks to upstream.
+			void release() noexcept {
+				trim(0);
+			}
+		};
+
+		///////////////////////////////////////////////////////////////////////
+		// Per-thread default resource
+		//
+		namespace __scratch {
+			inline scratch_resource*& thread_default() noexcept {
+				static thread_local scratch_resource* resource = nullptr;
+				return resource;
+			}
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		// Scratch cache
+		// When enabled, threads without a default resource of their own
+		// draw temporary buffers from a per-thread pool_scratch_resource
+		// rather than the global heap, so repeated calls to the buffered
+		// algorithms on inputs of similar size stop allocating once the
+		// cache is warm. Off unless STL2_SCRATCH_CACHE is nonzero, or
+		// until set_scratch_cache_enabled(true). Each thread's cache keeps
+		// at most STL2_SCRATCH_CACHE_LIMIT bytes unless told otherwise.
+		//
+		namespace __scratch {
+			inline std::atomic<bool>& cache_enabled() noexcept {
+				static std::atomic<bool> enabled{STL2_SCRATCH_CACHE != 0};
+				return enabled;
+			}
+		}
+
+		inline bool scratch_cache_enabled() noexcept {
+			return __scratch::cache_enabled().load(std::memory_order_relaxed);
+		}
+
+		// Turns the cache on or off for all threads; returns the previous
+		// setting. Caches that already hold blocks keep them until trimmed
+		// or until their thread exits.
+		inline bool set_scratch_cache_enabled(bool enable) noexcept {
+			return __scratch::cache_enabled().exchange(enable, std::memory_order_relaxed);
+		}
+
+		// The calling thread's cache.
+		inline pool_scratch_resource& thread_scratch_cache() noexcept {
+			static thread_local pool_scratch_resource cache{
+				new_delete_scratch_resource(), STL2_SCRATCH_CACHE_LIMIT};
+			return cache;
+		}
+
+		// Sets the number of bytes the calling thread's cache may keep.
+		inline void set_scratch_cache_limit(std::size_t bytes) noexcept {
+			ext::thread_scratch_cache().set_limit(bytes);
+		}
+
+		// Returns the calling thread's cached blocks to the global heap.
+		inline void trim_scratch_cache() noexcept {
+			ext::thread_scratch_cache().release();
+		}
+
+		inline scratch_resource* get_default_scratch_resource() noexcept {
+			if (auto r = __scratch::thread_default()) {
+				return r;
+			}
+			if (ext::scratch_cache_enabled()) {
+				return &ext::thread_scratch_cache();
+			}
+			return new_delete_scratch_resource();
+		}
+
+		// Makes r the calling thread's default and returns the previous
+		// setting, which is null if the thread had none. A null r restores
+		// the global heap, or the thread's cache if the cache is enabled.
+		inline scratch_resource* set_default_scratch_resource(scratch_resource* r) noexcept {
+			auto const previous = __scratch::thread_default();
+			__scratch::thread_default() = r;
+			return previous;
+		}
+
+		class scoped_scratch_resource {
+			scratch_resource* previous_;
+		public:
+			explicit scoped_scratch_resource(scratch_resource& r) noexcept
+			: previous_{ext::set_default_scratch_resource(&r)} {}
+			~scoped_scratch_resource() {
+				ext::set_default_scratch_resource(previous_);
+			}
+			scoped_scratch_resource(const scoped_scratch_resource&) = delete;
+			scoped_scratch_resource& operator=(const scoped_scratch_resource&) = delete;
+		};
+	}
+
+	namespace detail {
+		struct scratch_access {
+			// Allocates storage for up to n objects of the given size and
+			// alignment from r, halving the request on failure as
+			// get_temporary_buffer does, but never below min_n objects.
+			// Returns the storage and the number of objects it holds.
+			static pair<void*, std::ptrdiff_t>
+			request(ext::scratch_resource& r, std::ptrdiff_t n,
+				std::size_t size, std::size_t alignment,
+				std::ptrdiff_t min_n = 1) noexcept
+			{
+				if (n <= 0) {
+					return {nullptr, 0};
+				}
+				auto const max_n = static_cast<std::ptrdiff_t>(PTRDIFF_MAX / size);
+				if (n > max_n) {
+					n = max_n;
+				}
+				auto const wanted = static_cast<std::size_t>(n) * size;
+				r.requests_.fetch_add(1, std::memory_order_relaxed);
+				r.bytes_requested_.fetch_add(wanted, std::memory_order_relaxed);
+				if (min_n < 1) {
+					min_n = 1;
+				}
+				auto m = n;
+				void* p = nullptr;
+				for (; m >= min_n; m /= 2) {
+					p = r.allocate(static_cast<std::size_t>(m) * size, alignment);
+					if (p) {
+						break;
+					}
+				}
+				if (!p) {
+					m = 0;
+				}
+				if (m < n) {
+					r.fallbacks_.fetch_add(1, std::memory_order_relaxed);
+				}
+				if (m > 0) {
+					r.bytes_allocated_.fetch_add(static_cast<std::size_t>(m) * size,
+						std::memory_order_relaxed);
+				}
+				return {p, m};
+			}
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
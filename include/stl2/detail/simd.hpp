@@ -0,0 +1,197 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_SIMD_HPP
+#define STL2_DETAIL_SIMD_HPP
+
+#include <cstddef>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/memory.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Vectorizable kernels
+// Loops over contiguous arrays of arithmetic type, written without early
+// exits or data-dependent branches so that the compiler can turn them into
+// SIMD code. Searches scan fixed-size blocks branch-free and only look for
+// the exact position inside the block that contains a hit.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Contiguous ranges of arithmetic values that the kernels can process.
+		template <class I, class S>
+		constexpr bool simd_range = false;
+		template <class I, class S>
+		requires
+			models::ContiguousIterator<I> &&
+			models::SizedSentinel<S, I> &&
+			is_arithmetic<value_type_t<I>>::value
+		constexpr bool simd_range<I, S> = true;
+
+		// Comparison/projection pairs that mean "operator< on the elements."
+		template <class T, class Comp, class Proj>
+		constexpr bool simd_less =
+			models::Same<Proj, identity> &&
+			(models::Same<Comp, less<>> || models::Same<Comp, less<T>>);
+
+		// Comparison/projection pairs that mean "operator== on the elements."
+		template <class T, class Comp, class Proj>
+		constexpr bool simd_equal_to =
+			models::Same<Proj, identity> &&
+			(models::Same<Comp, equal_to<>> || models::Same<Comp, equal_to<T>>);
+
+		// Address of the first element of a non-empty contiguous range.
+		template <class I>
+		requires models::ContiguousIterator<I>
+		auto simd_data(const I& i) {
+			return __stl2::addressof(*i);
+		}
+
+		namespace simd {
+			constexpr std::ptrdiff_t block = 64;
+
+			template <class T>
+			std::ptrdiff_t count(const T* p, std::ptrdiff_t n, const T& value) noexcept {
+				std::ptrdiff_t result = 0;
+				for (std::ptrdiff_t i = 0; i < n; ++i) {
+					result += p[i] == value;
+				}
+				return result;
+			}
+
+			// Requires: n > 0
+			template <class T>
+			T min_value(const T* p, std::ptrdiff_t n) noexcept {
+				T m = p[0];
+				for (std::ptrdiff_t i = 1; i < n; ++i) {
+					m = p[i] < m ? p[i] : m;
+				}
+				return m;
+			}
+
+			// Requires: n > 0
+			template <class T>
+			T max_value(const T* p, std::ptrdiff_t n) noexcept {
+				T m = p[0];
+				for (std::ptrdiff_t i = 1; i < n; ++i) {
+					m = m < p[i] ? p[i] : m;
+				}
+				return m;
+			}
+
+			// Index of the first element equal to value, or n.
+			template <class T>
+			std::ptrdiff_t find(const T* p, std::ptrdiff_t n, const T& value) noexcept {
+				std::ptrdiff_t i = 0;
+				for (; n - i >= block; i += block) {
+					bool hit = false;
+					for (std::ptrdiff_t j = 0; j < block; ++j) {
+						hit |= p[i + j] == value;
+					}
+					if (hit) {
+						break;
+					}
+				}
+				for (; i < n; ++i) {
+					if (p[i] == value) {
+						break;
+					}
+				}
+				return i;
+			}
+
+			// Index of the last element equal to value, or -1.
+			template <class T>
+			std::ptrdiff_t find_last(const T* p, std::ptrdiff_t n, const T& value) noexcept {
+				std::ptrdiff_t i = n;
+				for (; i >= block; i -= block) {
+					bool hit = false;
+					for (std::ptrdiff_t j = 1; j <= block; ++j) {
+						hit |= p[i - j] == value;
+					}
+					if (hit) {
+						break;
+					}
+				}
+				while (i-- > 0) {
+					if (p[i] == value) {
+						break;
+					}
+				}
+				return i;
+			}
+
+			// Position of the first j in [lo, hi) with p[j] < p[j - 1], or hi.
+			// Requires: 0 < lo
+			template <class T>
+			std::ptrdiff_t is_sorted_until(const T* p, std::ptrdiff_t lo,
+				std::ptrdiff_t hi) noexcept
+			{
+				for (; hi - lo >= block; lo += block) {
+					bool hit = false;
+					for (std::ptrdiff_t j = 0; j < block; ++j) {
+						hit |= p[lo + j] < p[lo + j - 1];
+					}
+					if (hit) {
+						break;
+					}
+				}
+				for (; lo < hi; ++lo) {
+					if (p[lo] < p[lo - 1]) {
+						break;
+					}
+				}
+				return lo;
+			}
+
+			// Position of the first child c in [lo, hi) that compares greater
+			// than its parent in the max-heap rooted at p, or hi.
+			// Requires: 0 < lo
+			template <class T>
+			std::ptrdiff_t is_heap_until(const T* p, std::ptrdiff_t lo,
+				std::ptrdiff_t hi) noexcept
+			{
+				for (; hi - lo >= block; lo += block) {
+					bool hit = false;
+					for (std::ptrdiff_t j = 0; j < block; ++j) {
+						hit |= p[(lo + j - 1) / 2] < p[lo + j];
+					}
+					if (hit) {
+						break;
+					}
+				}
+				for (; lo < hi; ++lo) {
+					if (p[(lo - 1) / 2] < p[lo]) {
+						break;
+					}
+				}
+				return lo;
+			}
+
+			// Index of the first minimum. Requires: n > 0, T integral.
+			template <class T>
+			std::ptrdiff_t first_min(const T* p, std::ptrdiff_t n) noexcept {
+				return simd::find(p, n, simd::min_value(p, n));
+			}
+
+			// Index of the last maximum. Requires: n > 0, T integral.
+			template <class T>
+			std::ptrdiff_t last_max(const T* p, std::ptrdiff_t n) noexcept {
+				return simd::find_last(p, n, simd::max_value(p, n));
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,694 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_SWISS_TABLE_HPP
+#define STL2_DETAIL_SWISS_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/utility.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/function.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/memory/relocate.hpp>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define STL2_SWISS_TABLE_SSE2 1
+#else
+#define STL2_SWISS_TABLE_SSE2 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Open-addressing hash table with SwissTable-style control bytes
+// [Extension]
+// Elements live in one flat array of slots, with a parallel array of
+// control bytes: one per slot, holding either a marker for an empty or
+// deleted slot or the low seven bits of the element's hash. A lookup
+// splits the hash: the high bits pick a starting group of slots, and the
+// low seven bits are compared against a whole group of control bytes at
+// once, 16 at a time with SSE2 and 8 at a time in a 64-bit word
+// elsewhere. Only slots whose control byte matches are compared with the
+// key, so a lookup touches one or two cache lines of control bytes and,
+// almost always, only the slot it is looking for.
+//
+// The capacity is a power of two minus one. The control bytes are
+// followed by a sentinel, which stops iteration, and by copies of the
+// first group's bytes, so that a group can be loaded at any position
+// without wrapping. Probing moves from group to group in triangular
+// steps, which visits every group. The table grows when seven eighths of
+// the slots are in use or deleted; erasing leaves a deleted marker that
+// is cleared on the next rehash.
+//
+// A Policy describes what a slot holds:
+//   key_type, value_type, slot_type
+//   key(const slot_type&), key_of(const value_type&): the key
+//   element(slot_type&): the value_type in a full slot
+//   construct(slot_type*, args...), destroy(slot_type*)
+//   nothrow_transfer: whether transfer cannot throw
+//   transfer(slot_type* to, slot_type* from): relocates an element when
+//     the table rehashes. When it might throw, the table copies the
+//     elements instead, and destroys the originals once all are copied.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		namespace swiss {
+			using ctrl_t = signed char;
+			constexpr ctrl_t empty = -128;
+			constexpr ctrl_t deleted = -2;
+			constexpr ctrl_t sentinel = -1;
+
+			constexpr bool is_full(ctrl_t c) noexcept { return c >= 0; }
+
+			// Set of positions within a group, lowest first.
+			template <class Bits, int Shift>
+			class bitmask {
+				Bits bits_;
+
+			public:
+				explicit constexpr bitmask(Bits bits) noexcept : bits_{bits} {}
+
+				explicit constexpr operator bool() const noexcept { return bits_ != 0; }
+
+				int lowest() const noexcept {
+					return (sizeof(Bits) > sizeof(unsigned)
+						? __builtin_ctzll(bits_)
+						: __builtin_ctz(static_cast<unsigned>(bits_))) >> Shift;
+				}
+
+				bitmask begin() const noexcept { return *this; }
+				bitmask end() const noexcept { return bitmask{0}; }
+				int operator*() const noexcept { return lowest(); }
+				bitmask& operator++() noexcept {
+					bits_ &= bits_ - 1;
+					return *this;
+				}
+				friend bool operator!=(const bitmask& x, const bitmask& y) noexcept {
+					return x.bits_ != y.bits_;
+				}
+			};
+
+#if STL2_SWISS_TABLE_SSE2
+			class group {
+				__m128i ctrl_;
+
+			public:
+				static constexpr std::size_t width = 16;
+				using mask = bitmask<std::uint32_t, 0>;
+
+				explicit group(const ctrl_t* p) noexcept
+				: ctrl_{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))} {}
+
+				mask match(ctrl_t h) const noexcept {
+					return mask{static_cast<std::uint32_t>(_mm_movemask_epi8(
+						_mm_cmpeq_epi8(_mm_set1_epi8(h), ctrl_)))};
+				}
+
+				mask match_empty() const noexcept {
+					return match(empty);
+				}
+
+				mask match_empty_or_deleted() const noexcept {
+					return mask{static_cast<std::uint32_t>(_mm_movemask_epi8(
+						_mm_cmpgt_epi8(_mm_set1_epi8(sentinel), ctrl_)))};
+				}
+			};
+#else
+			class group {
+				static constexpr std::uint64_t lsbs = 0x0101010101010101ull;
+				static constexpr std::uint64_t msbs = 0x8080808080808080ull;
+				std::uint64_t ctrl_;
+
+			public:
+				static constexpr std::size_t width = 8;
+				using mask = bitmask<std::uint64_t, 3>;
+
+				explicit group(const ctrl_t* p) noexcept {
+					std::memcpy(&ctrl_, p, sizeof(ctrl_));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+					ctrl_ = __builtin_bswap64(ctrl_);
+#endif
+				}
+
+				// May report a false match in a byte that follows a true one;
+				// every match is confirmed against the key.
+				mask match(ctrl_t h) const noexcept {
+					auto const x = ctrl_ ^ (lsbs * static_cast<unsigned char>(h));
+					return mask{(x - lsbs) & ~x & msbs};
+				}
+
+				mask match_empty() const noexcept {
+					return mask{ctrl_ & ~(ctrl_ << 6) & msbs};
+				}
+
+				mask match_empty_or_deleted() const noexcept {
+					return mask{ctrl_ & ~(ctrl_ << 7) & msbs};
+				}
+			};
+#endif
+			constexpr std::size_t width = group::width;
+
+			// The control bytes of a table with no slots: a sentinel, so
+			// that iteration stops at once, and empties, so that lookups
+			// stop after one group.
+			inline ctrl_t* empty_group() noexcept {
+				alignas(16) static constexpr ctrl_t bytes[width] = {
+					sentinel, empty, empty, empty, empty, empty, empty, empty,
+#if STL2_SWISS_TABLE_SSE2
+					empty, empty, empty, empty, empty, empty, empty, empty
+#endif
+				};
+				return const_cast<ctrl_t*>(bytes);
+			}
+
+			// Spreads the bits of a hash, since std::hash is the identity for
+			// integers; the table takes its group index from the high bits
+			// and its control byte from the low seven.
+			inline std::size_t mix(std::size_t h) noexcept {
+				auto const m = static_cast<std::uint64_t>(h) * 0x9e3779b97f4a7c15ull;
+				return static_cast<std::size_t>(m ^ (m >> 32));
+			}
+
+			constexpr std::size_t h1(std::size_t h) noexcept { return h >> 7; }
+			constexpr ctrl_t h2(std::size_t h) noexcept {
+				return static_cast<ctrl_t>(h & 0x7f);
+			}
+
+			// Elements a table of the given capacity holds before it grows.
+			constexpr std::size_t capacity_to_growth(std::size_t capacity) noexcept {
+				return width == 8 && capacity == 7 ? 6 : capacity - capacity / 8;
+			}
+
+			// The smallest valid capacity that holds n elements.
+			inline std::size_t growth_to_capacity(std::size_t n) noexcept {
+				std::size_t capacity = 1;
+				while (capacity_to_growth(capacity) < n) {
+					capacity = capacity * 2 + 1;
+				}
+				return capacity;
+			}
+		}
+
+		// Hash hashes K. With the default std::hash<Key>, this is ext::Hashable.
+		template <class Hash, class K>
+		constexpr bool hash_function = false;
+		template <class Hash, class K>
+		requires
+			requires (const Hash& h, const K& k) {
+				{ h(k) } -> std::size_t;
+			}
+		constexpr bool hash_function<Hash, K> = true;
+
+		// Lookups by a K other than the key type are enabled, as for the
+		// standard unordered containers, when both the hash and the
+		// equality are transparent.
+		template <class Hash, class Eq, class Key, class K>
+		constexpr bool transparent_lookup = false;
+		template <class Hash, class Eq, class Key, class K>
+		requires
+			requires {
+				typename Hash::is_transparent;
+				typename Eq::is_transparent;
+			} &&
+			hash_function<Hash, K> &&
+			models::Predicate<Eq, const Key&, const K&>
+		constexpr bool transparent_lookup<Hash, Eq, Key, K> = true;
+
+		// Iteration over the full slots of a swiss_table.
+		template <class Policy, bool Const>
+		class swiss_cursor {
+			friend swiss_cursor<Policy, !Const>;
+			using slot_type = typename Policy::slot_type;
+			using element_t = meta::if_c<Const,
+				const typename Policy::value_type, typename Policy::value_type>;
+
+			const swiss::ctrl_t* ctrl_ = nullptr;
+			slot_type* slot_ = nullptr;
+
+			void skip_empty() noexcept {
+				while (*ctrl_ < swiss::sentinel) {
+					++ctrl_;
+					++slot_;
+				}
+			}
+
+		public:
+			using value_type = typename Policy::value_type;
+			using difference_type = std::ptrdiff_t;
+
+			swiss_cursor() = default;
+			// Starts at the first full slot at or after the given one.
+			swiss_cursor(const swiss::ctrl_t* ctrl, slot_type* slot) noexcept
+			: ctrl_{ctrl}, slot_{slot}
+			{
+				skip_empty();
+			}
+			swiss_cursor(const swiss_cursor<Policy, !Const>& that) noexcept
+			requires Const
+			: ctrl_{that.ctrl_}, slot_{that.slot_} {}
+
+			element_t& read() const noexcept { return Policy::element(*slot_); }
+			void next() noexcept {
+				++ctrl_;
+				++slot_;
+				skip_empty();
+			}
+			bool equal(const swiss_cursor& that) const noexcept {
+				return ctrl_ == that.ctrl_;
+			}
+
+			// The slot this cursor denotes.
+			slot_type* slot() const noexcept { return slot_; }
+		};
+
+		template <class Policy, class Hash, class Eq>
+		class swiss_table {
+		public:
+			using key_type = typename Policy::key_type;
+			using value_type = typename Policy::value_type;
+			using slot_type = typename Policy::slot_type;
+			using size_type = std::size_t;
+			using iterator = basic_iterator<swiss_cursor<Policy, false>>;
+			using const_iterator = basic_iterator<swiss_cursor<Policy, true>>;
+
+		private:
+			swiss::ctrl_t* ctrl_ = swiss::empty_group();
+			slot_type* slots_ = nullptr;
+			size_type capacity_ = 0;
+			size_type size_ = 0;
+			size_type growth_left_ = 0;
+			Hash hash_;
+			Eq eq_;
+
+			static std::allocator<swiss::ctrl_t> ctrl_allocator() noexcept { return {}; }
+			static std::allocator<slot_type> slot_allocator() noexcept { return {}; }
+
+			static size_type ctrl_bytes(size_type capacity) noexcept {
+				return capacity + swiss::width;
+			}
+
+			// Sets the control byte of slot i and its copy past the sentinel.
+			void set_ctrl(size_type i, swiss::ctrl_t h) noexcept {
+				ctrl_[i] = h;
+				ctrl_[((i - (swiss::width - 1)) & capacity_) +
+					((swiss::width - 1) & capacity_)] = h;
+			}
+
+			void reset_ctrl() noexcept {
+				std::memset(ctrl_, swiss::empty, ctrl_bytes(capacity_));
+				ctrl_[capacity_] = swiss::sentinel;
+				growth_left_ = swiss::capacity_to_growth(capacity_) - size_;
+			}
+
+			// The first empty or deleted slot on the probe sequence of hash.
+			// Pre: there is one.
+			size_type find_first_non_full(std::size_t hash) const noexcept {
+				auto pos = swiss::h1(hash) & capacity_;
+				for (std::size_t step = swiss::width;; step += swiss::width) {
+					auto const mask = swiss::group{ctrl_ + pos}.match_empty_or_deleted();
+					if (mask) {
+						return (pos + static_cast<size_type>(mask.lowest())) & capacity_;
+					}
+					pos = (pos + step) & capacity_;
+				}
+			}
+
+			void deallocate() noexcept {
+				if (capacity_ != 0) {
+					slot_allocator().deallocate(slots_, capacity_);
+					ctrl_allocator().deallocate(ctrl_, ctrl_bytes(capacity_));
+				}
+			}
+
+			void destroy_slots() noexcept {
+				if (size_ == 0) {
+					return;
+				}
+				for (size_type i = 0; i < capacity_; ++i) {
+					if (swiss::is_full(ctrl_[i])) {
+						Policy::destroy(slots_ + i);
+					}
+				}
+			}
+
+			// Moves every element into fresh arrays of the given capacity,
+			// which drops deleted markers. If a hash or a copy throws, the
+			// new arrays are freed and the table is left as it was, save that
+			// elements that can only be moved may have been moved from.
+			void resize(size_type capacity) {
+				STL2_ASSUME(capacity >= size_);
+				auto const new_ctrl = ctrl_allocator().allocate(ctrl_bytes(capacity));
+				slot_type* new_slots;
+				try {
+					new_slots = slot_allocator().allocate(capacity);
+				} catch(...) {
+					ctrl_allocator().deallocate(new_ctrl, ctrl_bytes(capacity));
+					throw;
+				}
+				auto const old_ctrl = ctrl_;
+				auto const old_slots = slots_;
+				auto const old_capacity = capacity_;
+				auto const old_growth_left = growth_left_;
+				ctrl_ = new_ctrl;
+				slots_ = new_slots;
+				capacity_ = capacity;
+				reset_ctrl();
+				try {
+					rehash_from(meta::bool_<Policy::nothrow_transfer>{},
+						old_ctrl, old_slots, old_capacity);
+				} catch(...) {
+					destroy_slots();
+					deallocate();
+					ctrl_ = old_ctrl;
+					slots_ = old_slots;
+					capacity_ = old_capacity;
+					growth_left_ = old_growth_left;
+					throw;
+				}
+				if (old_capacity != 0) {
+					slot_allocator().deallocate(old_slots, old_capacity);
+					ctrl_allocator().deallocate(old_ctrl, ctrl_bytes(old_capacity));
+				}
+			}
+
+			// Relocates the elements of the old arrays into the current ones.
+			// A hash that might throw is taken for every element before the
+			// first is relocated, so that a throw strands none of them.
+			void rehash_from(true_type, const swiss::ctrl_t* old_ctrl,
+				slot_type* old_slots, size_type old_capacity)
+			{
+				constexpr bool nothrow_hash = noexcept(
+					declval<const Hash&>()(declval<const key_type&>()));
+				std::unique_ptr<std::size_t[]> hashes;
+				if (!nothrow_hash) {
+					hashes.reset(new std::size_t[size_]);
+					size_type n = 0;
+					for (size_type i = 0; i < old_capacity; ++i) {
+						if (swiss::is_full(old_ctrl[i])) {
+							hashes[n++] = hash_of(Policy::key(old_slots[i]));
+						}
+					}
+				}
+				size_type n = 0;
+				for (size_type i = 0; i < old_capacity; ++i) {
+					if (swiss::is_full(old_ctrl[i])) {
+						auto const hash = nothrow_hash
+							? hash_of(Policy::key(old_slots[i])) : hashes[n++];
+						auto const j = find_first_non_full(hash);
+						set_ctrl(j, swiss::h2(hash));
+						Policy::transfer(slots_ + j, old_slots + i);
+					}
+				}
+			}
+
+			// Copies the elements of the old arrays into the current ones, or
+			// moves those that cannot be copied, and destroys the originals
+			// only once every element is in place.
+			void rehash_from(false_type, const swiss::ctrl_t* old_ctrl,
+				slot_type* old_slots, size_type old_capacity)
+			{
+				using source_t = meta::if_c<is_copy_constructible<value_type>::value,
+					const value_type&, value_type&&>;
+				for (size_type i = 0; i < old_capacity; ++i) {
+					if (swiss::is_full(old_ctrl[i])) {
+						auto const hash = hash_of(Policy::key(old_slots[i]));
+						auto const j = find_first_non_full(hash);
+						Policy::construct(slots_ + j,
+							static_cast<source_t>(Policy::element(old_slots[i])));
+						set_ctrl(j, swiss::h2(hash));
+					}
+				}
+				for (size_type i = 0; i < old_capacity; ++i) {
+					if (swiss::is_full(old_ctrl[i])) {
+						Policy::destroy(old_slots + i);
+					}
+				}
+			}
+
+			// Makes room for one more element: rehashes in place when deleted
+			// markers take up much of the table, and doubles it otherwise.
+			void grow() {
+				if (capacity_ > swiss::width && size_ * 32 <= capacity_ * 25) {
+					resize(capacity_);
+				} else {
+					resize(capacity_ * 2 + 1);
+				}
+			}
+
+			template <class K>
+			std::size_t hash_of(const K& k) const {
+				return swiss::mix(hash_(k));
+			}
+
+			// Index of the element equivalent to k, or capacity_.
+			template <class K>
+			size_type find_index(const K& k, std::size_t hash) const {
+				auto pos = swiss::h1(hash) & capacity_;
+				auto const h = swiss::h2(hash);
+				for (std::size_t step = swiss::width;; step += swiss::width) {
+					swiss::group const g{ctrl_ + pos};
+					for (int i : g.match(h)) {
+						auto const j = (pos + static_cast<size_type>(i)) & capacity_;
+						if (eq_(Policy::key(slots_[j]), k)) {
+							return j;
+						}
+					}
+					if (g.match_empty()) {
+						return capacity_;
+					}
+					pos = (pos + step) & capacity_;
+				}
+			}
+
+			iterator iterator_at(size_type i) noexcept {
+				return iterator{swiss_cursor<Policy, false>{ctrl_ + i, slots_ + i}};
+			}
+
+			const_iterator iterator_at(size_type i) const noexcept {
+				return const_iterator{swiss_cursor<Policy, true>{ctrl_ + i, slots_ + i}};
+			}
+
+			void swap_state(swiss_table& that) noexcept {
+				using std::swap;
+				swap(ctrl_, that.ctrl_);
+				swap(slots_, that.slots_);
+				swap(capacity_, that.capacity_);
+				swap(size_, that.size_);
+				swap(growth_left_, that.growth_left_);
+			}
+
+		public:
+			swiss_table() = default;
+
+			swiss_table(size_type n, const Hash& hash, const Eq& eq)
+			: hash_(hash), eq_(eq)
+			{
+				reserve(n);
+			}
+
+			swiss_table(const swiss_table& that)
+			: hash_(that.hash_), eq_(that.eq_)
+			{
+				reserve(that.size_);
+				try {
+					for (auto&& e : that) {
+						auto const hash = hash_of(Policy::key_of(e));
+						auto const j = find_first_non_full(hash);
+						Policy::construct(slots_ + j, e);
+						set_ctrl(j, swiss::h2(hash));
+						++size_;
+						--growth_left_;
+					}
+				} catch(...) {
+					destroy_slots();
+					deallocate();
+					throw;
+				}
+			}
+
+			swiss_table(swiss_table&& that)
+			noexcept(is_nothrow_move_constructible<Hash>::value &&
+				is_nothrow_move_constructible<Eq>::value)
+			: hash_(__stl2::move(that.hash_)), eq_(__stl2::move(that.eq_))
+			{
+				swap_state(that);
+			}
+
+			swiss_table& operator=(const swiss_table& that) {
+				if (this != &that) {
+					swiss_table tmp(that);
+					swap(tmp);
+				}
+				return *this;
+			}
+
+			swiss_table& operator=(swiss_table&& that)
+			noexcept(is_nothrow_move_assignable<Hash>::value &&
+				is_nothrow_move_assignable<Eq>::value)
+			{
+				if (this != &that) {
+					clear();
+					deallocate();
+					ctrl_ = swiss::empty_group();
+					slots_ = nullptr;
+					capacity_ = 0;
+					growth_left_ = 0;
+					swap_state(that);
+					hash_ = __stl2::move(that.hash_);
+					eq_ = __stl2::move(that.eq_);
+				}
+				return *this;
+			}
+
+			~swiss_table() {
+				destroy_slots();
+				deallocate();
+			}
+
+			iterator begin() noexcept { return iterator_at(0); }
+			iterator end() noexcept { return iterator_at(capacity_); }
+			const_iterator begin() const noexcept { return iterator_at(0); }
+			const_iterator end() const noexcept { return iterator_at(capacity_); }
+
+			bool empty() const noexcept { return size_ == 0; }
+			size_type size() const noexcept { return size_; }
+			size_type capacity() const noexcept { return capacity_; }
+			size_type max_size() const noexcept {
+				return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(slot_type);
+			}
+
+			const Hash& hash_function() const noexcept { return hash_; }
+			const Eq& key_eq() const noexcept { return eq_; }
+
+			void clear() noexcept {
+				destroy_slots();
+				size_ = 0;
+				if (capacity_ != 0) {
+					reset_ctrl();
+				}
+			}
+
+			// Makes room for n elements without further rehashing.
+			void reserve(size_type n) {
+				if (n > size_ + growth_left_) {
+					resize(swiss::growth_to_capacity(n));
+				}
+			}
+
+			// Rehashes into at least n slots, and at least enough for the
+			// elements; rehash(0) shrinks the table to fit.
+			void rehash(size_type n) {
+				if (n == 0 && size_ == 0) {
+					destroy_slots();
+					deallocate();
+					ctrl_ = swiss::empty_group();
+					slots_ = nullptr;
+					capacity_ = 0;
+					growth_left_ = 0;
+					return;
+				}
+				auto capacity = swiss::growth_to_capacity(size_);
+				while (capacity < n) {
+					capacity = capacity * 2 + 1;
+				}
+				if (n == 0 || capacity > capacity_) {
+					resize(capacity);
+				}
+			}
+
+			// Finds the element equivalent to k, or calls
+			// construct(slot_type*) to create one in a free slot.
+			template <class K, class F>
+			pair<iterator, bool> find_or_emplace(const K& k, F&& construct) {
+				auto const hash = hash_of(k);
+				auto const found = find_index(k, hash);
+				if (found != capacity_) {
+					return {iterator_at(found), false};
+				}
+				auto i = find_first_non_full(hash);
+				if (growth_left_ == 0 && ctrl_[i] != swiss::deleted) {
+					grow();
+					i = find_first_non_full(hash);
+				}
+				construct(slots_ + i);
+				if (ctrl_[i] == swiss::empty) {
+					--growth_left_;
+				}
+				set_ctrl(i, swiss::h2(hash));
+				++size_;
+				return {iterator_at(i), true};
+			}
+
+			template <class K>
+			iterator find(const K& k) {
+				auto const i = find_index(k, hash_of(k));
+				return i == capacity_ ? end() : iterator_at(i);
+			}
+
+			template <class K>
+			const_iterator find(const K& k) const {
+				auto const i = find_index(k, hash_of(k));
+				return i == capacity_ ? end() : iterator_at(i);
+			}
+
+			template <class K>
+			bool contains(const K& k) const {
+				return find_index(k, hash_of(k)) != capacity_;
+			}
+
+			template <class K>
+			size_type erase_key(const K& k) {
+				auto const i = find_index(k, hash_of(k));
+				if (i == capacity_) {
+					return 0;
+				}
+				erase_at(i);
+				return 1;
+			}
+
+			void erase_at(size_type i) noexcept {
+				Policy::destroy(slots_ + i);
+				set_ctrl(i, swiss::deleted);
+				--size_;
+			}
+
+			// Erases the element i denotes; returns the iterator after it.
+			iterator erase(const_iterator i) noexcept {
+				auto const n = static_cast<size_type>(
+					__stl2::get_cursor(i).slot() - slots_);
+				erase_at(n);
+				return iterator_at(n + 1);
+			}
+
+			void swap(swiss_table& that)
+			noexcept(is_nothrow_swappable_v<Hash&, Hash&> &&
+				is_nothrow_swappable_v<Eq&, Eq&>)
+			{
+				swap_state(that);
+				__stl2::swap(hash_, that.hash_);
+				__stl2::swap(eq_, that.eq_);
+			}
+
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#undef STL2_SWISS_TABLE_SSE2
+
+#endif
@@ -12,34 +12,55 @@
 #ifndef STL2_DETAIL_TEMPORARY_VECTOR_HPP
 #define STL2_DETAIL_TEMPORARY_VECTOR_HPP
 
+#include <cstdint>
+#include <new>
 #include <stl2/memory.hpp>
 #include <stl2/type_traits.hpp>
 #include <stl2/utility.hpp>
 #include <stl2/detail/construct_destruct.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/scratch_resource.hpp>
 #include <stl2/detail/algorithm/for_each.hpp>
 #include <stl2/detail/concepts/object.hpp>
 
 STL2_OPEN_NAMESPACE {
 	namespace detail {
+		// Returns a temporary buffer's storage to the scratch resource it
+		// came from.
 		struct temporary_buffer_deleter {
-			void operator()(auto* ptr) const {
-				__stl2::return_temporary_buffer(ptr);
+			ext::scratch_resource* resource_ = nullptr;
+			std::size_t bytes_ = 0;
+			std::size_t alignment_ = alignof(std::max_align_t);
+
+			void operator()(void* ptr) const noexcept {
+				resource_->deallocate(ptr, bytes_, alignment_);
 			}
 		};
 
+		// Uninitialized storage for up to n objects of type T, drawn from a
+		// scratch resource: the calling thread's default, unless one is
+		// given. May hold fewer than n objects if the resource can't
+		// provide the whole request, but never fewer than min_n unless it
+		// holds none at all.
 		template <class T>
 		class temporary_buffer {
 			unique_ptr<T, temporary_buffer_deleter> alloc_;
 			std::ptrdiff_t size_ = 0;
 
-			temporary_buffer(pair<T*, std::ptrdiff_t> buf) :
-				alloc_{buf.first}, size_{buf.second} {}
-
 		public:
 			temporary_buffer() = default;
 			temporary_buffer(std::ptrdiff_t n)
-			: temporary_buffer(__stl2::get_temporary_buffer<T>(n)) {}
+			: temporary_buffer(n, *ext::get_default_scratch_resource()) {}
+			temporary_buffer(std::ptrdiff_t n, ext::scratch_resource& r,
+				std::ptrdiff_t min_n = 1)
+			{
+				auto buf = scratch_access::request(r, n, sizeof(T), alignof(T), min_n);
+				if (buf.second > 0) {
+					alloc_ = {static_cast<T*>(buf.first), temporary_buffer_deleter{
+						&r, static_cast<std::size_t>(buf.second) * sizeof(T), alignof(T)}};
+					size_ = buf.second;
+				}
+			}
 
 			T* data() const {
 				return alloc_.get();
@@ -60,26 +81,35 @@ STL2_OPEN_NAMESPACE {
 			static_assert((alignof(T) & (alignof(T) - 1)) == 0,
 				"Alignment must be a power of two.");
 
-			temporary_buffer(pair<unsigned char*, std::ptrdiff_t> buf)
-			: alloc_{buf.first}
+		public:
+			temporary_buffer() = default;
+			temporary_buffer(std::ptrdiff_t n)
+			: temporary_buffer(n, *ext::get_default_scratch_resource()) {}
+			temporary_buffer(std::ptrdiff_t n, ext::scratch_resource& r,
+				std::ptrdiff_t min_n = 1)
 			{
-				if (buf.second > 0 && static_cast<std::size_t>(buf.second) >= sizeof(T)) {
+				if (n <= 0) {
+					return;
+				}
+				auto const padding = static_cast<std::ptrdiff_t>(alignof(T) - 1);
+				auto buf = scratch_access::request(r,
+					n * sizeof(T) + padding, 1, alignof(std::max_align_t),
+					(min_n > 0 ? min_n : 1) * sizeof(T) + padding);
+				if (buf.second <= 0) {
+					return;
+				}
+				alloc_ = {static_cast<unsigned char*>(buf.first), temporary_buffer_deleter{
+					&r, static_cast<std::size_t>(buf.second), alignof(std::max_align_t)}};
+				if (static_cast<std::size_t>(buf.second) >= sizeof(T)) {
 					void* ptr = buf.first;
-					std::size_t n = buf.second;
-					aligned_ = static_cast<T*>(__stl2::align(alignof(T), sizeof(T), ptr, n));
+					std::size_t space = buf.second;
+					aligned_ = static_cast<T*>(__stl2::align(alignof(T), sizeof(T), ptr, space));
 					if (aligned_) {
-						size_ = n / sizeof(T);
+						size_ = space / sizeof(T);
 					}
 				}
 			}
 
-		public:
-			temporary_buffer() = default;
-			temporary_buffer(std::ptrdiff_t n)
-			: temporary_buffer(__stl2::get_temporary_buffer<unsigned char>(
-				n * sizeof(T) + alignof(T) - 1))
-			{}
-
 			T* data() const {
 				return aligned_;
 			}
@@ -109,7 +139,7 @@ STL2_OPEN_NAMESPACE {
 			temporary_vector() = default;
 			temporary_vector(temporary_buffer<T>& buf)
 			: begin_{buf.data()}, end_{begin_}
-			, alloc_{begin_ + buf.size_} {}
+			, alloc_{begin_ + buf.size()} {}
 			temporary_vector(temporary_vector&&) = delete;
 			temporary_vector& operator=(temporary_vector&& that) = delete;
 
@@ -163,6 +193,234 @@ STL2_OPEN_NAMESPACE {
 		temporary_vector<T> make_temporary_vector(temporary_buffer<T>& buf) {
 			return {buf};
 		}
+
+		///////////////////////////////////////////////////////////////////////
+		// scratch_vector
+		// A growable temporary_vector. The first N elements live in inline
+		// storage; beyond that, storage comes from a scratch resource (the
+		// calling thread's default unless one is given; none at all for a
+		// null resource). try_reserve reports failure instead of throwing,
+		// and remembers the smallest request the resource refused so that
+		// recursive algorithms probing for a buffer don't ask again for
+		// one at least as large.
+		//
+		template <class T>
+		constexpr std::ptrdiff_t scratch_inline_capacity =
+			sizeof(T) <= 256 ? static_cast<std::ptrdiff_t>(256 / sizeof(T)) : 0;
+
+		template <Destructible T, std::ptrdiff_t N = scratch_inline_capacity<T>>
+		class scratch_vector {
+			static_assert(N >= 0, "Inline capacity must not be negative.");
+
+			alignas(T) unsigned char inline_[N > 0 ? N * sizeof(T) : 1];
+			ext::scratch_resource* resource_;
+			temporary_buffer<T> heap_;
+			T* begin_ = inline_data();
+			T* end_ = begin_;
+			T* alloc_ = begin_ + N;
+			std::ptrdiff_t refused_ = PTRDIFF_MAX;
+
+			T* inline_data() noexcept {
+				return reinterpret_cast<T*>(inline_);
+			}
+
+			bool is_inline() const noexcept {
+				return heap_.data() == nullptr;
+			}
+
+			void _clear() noexcept {
+				__stl2::for_each(begin_, end_, destruct);
+			}
+
+			// Moves the elements into buf, which becomes the storage.
+			void relocate(temporary_buffer<T>&& buf)
+			noexcept(is_nothrow_move_constructible<T>::value)
+			{
+				T* const data = buf.data();
+				T* out = data;
+				try {
+					for (T* i = begin_; i != end_; ++i, ++out) {
+						detail::construct(*out, __stl2::move(*i));
+					}
+				} catch(...) {
+					__stl2::for_each(data, out, destruct);
+					throw;
+				}
+				_clear();
+				heap_ = __stl2::move(buf);
+				begin_ = data;
+				end_ = out;
+				alloc_ = data + heap_.size();
+			}
+
+			// Moves that's elements into this vector's (empty) storage, which
+			// must be large enough, and empties that.
+			void steal(scratch_vector& that)
+			noexcept(is_nothrow_move_constructible<T>::value)
+			{
+				STL2_ASSUME(empty());
+				if (!that.is_inline()) {
+					heap_ = __stl2::move(that.heap_);
+					that.heap_ = temporary_buffer<T>{};
+					begin_ = that.begin_;
+					end_ = that.end_;
+					alloc_ = that.alloc_;
+					that.begin_ = that.end_ = that.inline_data();
+					that.alloc_ = that.begin_ + N;
+					return;
+				}
+				STL2_ASSUME(that.size() <= capacity());
+				for (auto& e : that) {
+					detail::construct(*end_, __stl2::move(e));
+					++end_;
+				}
+				that.clear();
+			}
+
+			// Storage for at least n elements, preferably twice the capacity.
+			temporary_buffer<T> grown(std::ptrdiff_t n) {
+				auto want = 2 * capacity();
+				if (want < n) {
+					want = n;
+				}
+				if (!resource_ || n >= refused_) {
+					throw std::bad_alloc{};
+				}
+				temporary_buffer<T> buf{want, *resource_, n};
+				if (buf.size() < n) {
+					refused_ = n;
+					throw std::bad_alloc{};
+				}
+				return buf;
+			}
+
+			template <class...Args>
+			void emplace_back_slow(Args&&...args) {
+				auto buf = grown(size() + 1);
+				T* const pos = buf.data() + size();
+				// Construct the new element first: args may refer to an
+				// element of this vector.
+				detail::construct(*pos, __stl2::forward<Args>(args)...);
+				try {
+					relocate(__stl2::move(buf));
+				} catch(...) {
+					detail::destruct(*pos);
+					throw;
+				}
+				STL2_ASSUME(end_ == pos);
+				++end_;
+			}
+
+		public:
+			using value_type = T;
+
+			explicit scratch_vector(
+				ext::scratch_resource* r = ext::get_default_scratch_resource()) noexcept
+			: resource_{r} {}
+
+			scratch_vector(scratch_vector&& that)
+			noexcept(is_nothrow_move_constructible<T>::value)
+			: resource_{that.resource_}, refused_{that.refused_}
+			{
+				steal(that);
+			}
+
+			scratch_vector& operator=(scratch_vector&& that)
+			noexcept(is_nothrow_move_constructible<T>::value)
+			{
+				if (this != &that) {
+					clear();
+					if (!that.is_inline()) {
+						heap_ = temporary_buffer<T>{};
+						begin_ = end_ = inline_data();
+						alloc_ = begin_ + N;
+					}
+					resource_ = that.resource_;
+					refused_ = that.refused_;
+					steal(that);
+				}
+				return *this;
+			}
+
+			~scratch_vector() {
+				_clear();
+			}
+
+			// Ensures room for n elements; returns false, leaving the vector
+			// unchanged, if the storage can't be had.
+			bool try_reserve(std::ptrdiff_t n)
+			noexcept(is_nothrow_move_constructible<T>::value)
+			{
+				if (n <= capacity()) {
+					return true;
+				}
+				if (!resource_ || n >= refused_) {
+					return false;
+				}
+				temporary_buffer<T> buf{n, *resource_, n};
+				if (buf.size() < n) {
+					refused_ = n;
+					return false;
+				}
+				relocate(__stl2::move(buf));
+				return true;
+			}
+
+			void reserve(std::ptrdiff_t n) {
+				if (!try_reserve(n)) {
+					throw std::bad_alloc{};
+				}
+			}
+
+			void clear() noexcept {
+				_clear();
+				end_ = begin_;
+			}
+
+			constexpr bool empty() const noexcept {
+				return begin_ == end_;
+			}
+
+			constexpr std::ptrdiff_t capacity() const noexcept {
+				return alloc_ - begin_;
+			}
+			constexpr std::ptrdiff_t size() const noexcept {
+				return end_ - begin_;
+			}
+
+			ext::scratch_resource* resource() const noexcept {
+				return resource_;
+			}
+
+			constexpr T* begin() noexcept { return begin_; }
+			constexpr T* end() noexcept { return end_; }
+			constexpr const T* begin() const noexcept { return begin_; }
+			constexpr const T* end() const noexcept { return end_; }
+
+			constexpr T& operator[](std::ptrdiff_t i) noexcept {
+				STL2_ASSUME(0 <= i);
+				STL2_ASSUME(i < end_ - begin_);
+				return begin_[i];
+			}
+
+			template <class...Args>
+			requires Constructible<T, Args...>()
+			void emplace_back(Args&&...args)
+			{
+				if (end_ == alloc_) {
+					emplace_back_slow(__stl2::forward<Args>(args)...);
+					return;
+				}
+				detail::construct(*end_, __stl2::forward<Args>(args)...);
+				++end_;
+			}
+			void push_back(const T& t)
+			requires CopyConstructible<T>()
+			{ emplace_back(t); }
+			void push_back(T&& t)
+			requires MoveConstructible<T>()
+			{ emplace_back(__stl2::move(t)); }
+		};
 	}
 } STL2_CLOSE_NAMESPACE
 
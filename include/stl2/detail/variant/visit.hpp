@@ -41,12 +41,49 @@ STL2_OPEN_NAMESPACE {
 					meta::compose<non_void_predicate, meta::quote<meta::second>>>,
 				meta::quote<meta::first>>;
 
-		template <Variant...Variants>
-		constexpr std::size_t total_alternatives = 1;
-		template <Variant First, Variant...Rest>
-		constexpr std::size_t total_alternatives<First, Rest...> =
-			non_void_types<VariantTypes<First>>::size() *
-			total_alternatives<Rest...>;
+		template <class V>
+		using non_void_index_sequence =
+			__as_integer_sequence<non_void_indices<VariantTypes<V>>>;
+
+		///////////////////////////////////////////////////////////////////////////
+		// Combinations of alternatives are numbered in row-major order: the
+		// k-th combination of Ns... alternatives has the alternative
+		// mixed_radix_digit<Ns...>(k, j) in the j-th variant. Enumerating
+		// combinations this way rather than with cartesian_product keeps
+		// the instantiation depth constant however many there are.
+		//
+		template <std::size_t...Ns>
+		constexpr std::size_t mixed_radix_digit(std::size_t k, std::size_t j) noexcept {
+			constexpr std::size_t radices[] = {Ns...};
+			for (auto i = sizeof...(Ns) - 1; i > j; --i) {
+				k /= radices[i];
+			}
+			return k % radices[j];
+		}
+
+		template <std::size_t...Is>
+		constexpr std::size_t nth_index(std::index_sequence<Is...>, std::size_t n) noexcept {
+			constexpr std::size_t indices[] = {Is..., 0};
+			return indices[n];
+		}
+
+		// The K-th combination of the non-void alternatives of Vs.
+		template <std::size_t K, class Js, class...Vs>
+		struct visit_vector_ {};
+		template <std::size_t K, std::size_t...Js, class...Vs>
+		struct visit_vector_<K, std::index_sequence<Js...>, Vs...> {
+			using type = meta::list<meta::size_t<
+				nth_index(non_void_index_sequence<Vs>{},
+					mixed_radix_digit<non_void_index_sequence<Vs>::size()...>(K, Js))>...>;
+		};
+
+		template <class Ks, class...Vs>
+		struct all_visit_vectors_ {};
+		template <std::size_t...Ks, class...Vs>
+		struct all_visit_vectors_<std::index_sequence<Ks...>, Vs...> {
+			using type = meta::list<meta::_t<visit_vector_<Ks,
+				std::make_index_sequence<sizeof...(Vs)>, Vs...>>...>;
+		};
 
 		///////////////////////////////////////////////////////////////////////////
 		// Determine the return type and noexcept status of visitor F on Variants
@@ -73,8 +110,10 @@ STL2_OPEN_NAMESPACE {
 			meta::bool_<single_visit_properties<F, Variants, Indices>::nothrow>;
 
 		template <Variant...Vs>
-		using all_visit_vectors =
-			meta::cartesian_product<meta::list<non_void_indices<VariantTypes<Vs>>...>>;
+		using all_visit_vectors = meta::_t<all_visit_vectors_<
+			std::make_index_sequence<
+				(non_void_index_sequence<Vs>::size() * ... * std::size_t{1})>,
+			Vs...>>;
 
 		///////////////////////////////////////////////////////////////////////////
 		// Create a list of all possible return types from F visiting Vs
@@ -108,10 +147,20 @@ STL2_OPEN_NAMESPACE {
 
 		#else
 		// Require the return type of all alternatives to have a common
-		// reference type, which visit returns.
+		// reference type, which visit returns. When the return types are
+		// all the same, as they usually are, skip common_reference: its
+		// recursion is as deep as the thousands of combinations of
+		// alternatives that a few large variants have.
+		template <class Types>
+		struct common_return {};
+		template <class T, class...Ts>
+		struct common_return<meta::list<T, Ts...>>
+		: meta::if_<
+			is_same<meta::list<Ts...>, meta::repeat_n_c<sizeof...(Ts), T>>,
+			meta::id<T>, common_reference<T, Ts...>> {};
+
 		template <class F, Variant...Vs>
-		using VisitReturn =
-			meta::apply<meta::quote<common_reference_t>, all_return_types<F, Vs...>>;
+		using VisitReturn = meta::_t<common_return<all_return_types<F, Vs...>>>;
 		#endif
 
 		template <class F, class...Vs>
@@ -125,9 +174,6 @@ STL2_OPEN_NAMESPACE {
 					meta::bind_front<meta::quote<single_visit_noexcept>,
 						F, meta::list<Vs...>>>>>;
 
-		// TODO: Tune.
-		constexpr std::size_t O1_visit_threshold = 5;
-
 		template <std::size_t...Is, Variant...Vs, RawVisitorWithIndices<Vs...> F>
 		constexpr VisitReturn<F, Vs...>
 		visit_handler(std::index_sequence<Is...> indices, F&& f, Vs&&...vs)
@@ -137,96 +183,10 @@ STL2_OPEN_NAMESPACE {
 		)
 
 		///////////////////////////////////////////////////////////////////////////
-		// O(N) visitor implementation
-		//
-		RawVisitorWithIndices{F, ...Vs}
-		class ON_dispatch {
-			using R = VisitReturn<F, Vs...>;
-			static constexpr std::size_t N = sizeof...(Vs);
-
-			F&& f_;
-			tuple<Vs&&...> vs_;
-
-			template <std::size_t...Is, std::size_t...Js>
-			requires sizeof...(Is) == N && sizeof...(Js) == N
-			constexpr R invoke(std::index_sequence<Is...> i, std::index_sequence<Js...>)
-			noexcept(noexcept(visit_handler(i, __stl2::forward<F>(f_),
-				__stl2::get<Js>(__stl2::move(vs_))...)))
-			{
-				return visit_handler(i, __stl2::forward<F>(f_),
-					__stl2::get<Js>(__stl2::move(vs_))...);
-			}
-
-			template <std::size_t...Is>
-			requires sizeof...(Is) == N
-			constexpr R find_indices(std::index_sequence<Is...> i)
-			noexcept(noexcept(declval<ON_dispatch&>().
-				invoke(i, std::make_index_sequence<N>{})))
-			{
-				return invoke(i, std::make_index_sequence<N>{});
-			}
-
-			template <std::size_t...Is, std::size_t Last>
-			constexpr R find_one_index(std::index_sequence<Is...>, std::size_t n, std::index_sequence<Last>)
-			noexcept(noexcept(declval<ON_dispatch&>().
-				find_indices(std::index_sequence<Is..., Last>{})))
-			{
-				STL2_ASSUME(n == Last);
-				(void)n;
-				return find_indices(std::index_sequence<Is..., Last>{});
-			}
-
-			template <std::size_t...Is, std::size_t First, std::size_t...Rest>
-			constexpr R find_one_index(std::index_sequence<Is...> i, std::size_t n, std::index_sequence<First, Rest...>)
-			noexcept(noexcept(
-				declval<ON_dispatch&>().find_indices(std::index_sequence<Is..., First>{}),
-				declval<ON_dispatch&>().find_one_index(i, n, std::index_sequence<Rest...>{})))
-			{
-				STL2_ASSUME(n >= First);
-				if (n <= First) {
-					return find_indices(std::index_sequence<Is..., First>{});
-				} else {
-					return find_one_index(i, n, std::index_sequence<Rest...>{});
-				}
-			}
-
-			template <std::size_t...Is,
-				class NVI = __as_integer_sequence<non_void_indices<
-					VariantTypes<meta::at_c<meta::list<Vs...>, sizeof...(Is)>>>>>
-			requires sizeof...(Is) < N
-			constexpr R find_indices(std::index_sequence<Is...> i)
-			noexcept(noexcept(declval<ON_dispatch&>()
-				.find_one_index(i, std::size_t{0}, NVI{})))
-			{
-				auto& v = __stl2::get<sizeof...(Is)>(vs_);
-				STL2_ASSUME_CONSTEXPR(v.valid());
-				return find_one_index(i, v.index(), NVI{});
-			}
-
-		public:
-			constexpr ON_dispatch(F&& f, Vs&&...vs) noexcept
-			: f_(__stl2::forward<F>(f)), vs_{__stl2::forward<Vs>(vs)...} {}
-
-			constexpr R visit() &&
-			noexcept(VisitNothrow<F, Vs...>)
-			{
-				return find_indices(std::index_sequence<>{});
-			}
-		};
-
-		RawVisitorWithIndices{F, ...Vs}
-		constexpr VisitReturn<F, Vs...>
-		raw_visit_with_indices(F&& f, Vs&&...vs)
-		noexcept(VisitNothrow<F, Vs...>)
-		requires total_alternatives<Vs...> < O1_visit_threshold
-		{
-			return ON_dispatch<F, Vs...>{
-				__stl2::forward<F>(f), __stl2::forward<Vs>(vs)...
-			}.visit();
-		}
-
-		///////////////////////////////////////////////////////////////////////////
-		// O(1) visitor implementation
+		// O(1) visitor implementation: a table with a handler for every
+		// combination of alternatives, indexed by the alternatives' indices
+		// flattened in row-major order. Visitation is one indirect call
+		// whatever the number of alternatives or variants.
 		//
 		template <class I, class F, Variant...Vs>
 		requires RawVisitorWithIndices<F, Vs...>
@@ -241,6 +201,8 @@ STL2_OPEN_NAMESPACE {
 		using visit_handler_ptr =
 			VisitReturn<F, Vs...>(*)(F&&, Vs&&...);
 
+		// Combinations with a void alternative, which a variant never
+		// holds, get no handler.
 		template <class Indices, class F, Variant...Vs>
 		requires RawVisitorWithIndices<F, Vs...>
 		constexpr visit_handler_ptr<F, Vs...> visit_handler_for = {};
@@ -253,21 +215,37 @@ STL2_OPEN_NAMESPACE {
 			visit_handler_for<std::index_sequence<Is...>, F, Vs...> =
 				&o1_visit_handler<std::index_sequence<Is...>, F, Vs...>;
 
-		template <class Indices, class F, Variant...Vs>
+		template <Variant...Vs>
+		constexpr std::size_t total_indices =
+			(VariantTypes<Vs>::size() * ... * std::size_t{1});
+
+		template <std::size_t K, class Js, class...Vs>
+		struct unflatten_indices;
+		template <std::size_t K, std::size_t...Js, Variant...Vs>
+		struct unflatten_indices<K, std::index_sequence<Js...>, Vs...> {
+			using type = std::index_sequence<
+				mixed_radix_digit<VariantTypes<Vs>::size()...>(K, Js)...>;
+		};
+
+		template <std::size_t K, Variant...Vs>
+		using unflatten_indices_t = meta::_t<unflatten_indices<K,
+			std::make_index_sequence<sizeof...(Vs)>, Vs...>>;
+
+		template <class Ks, class F, Variant...Vs>
 		requires RawVisitorWithIndices<F, Vs...>
 		struct O1_dispatch;
-		template <class...Is, class F, Variant...Vs>
+		template <std::size_t...Ks, class F, Variant...Vs>
 		requires RawVisitorWithIndices<F, Vs...>
-		struct O1_dispatch<meta::list<Is...>, F, Vs...> {
+		struct O1_dispatch<std::index_sequence<Ks...>, F, Vs...> {
 			static constexpr visit_handler_ptr<F, Vs...> table[] = {
-				visit_handler_for<Is, F, Vs...>...
+				visit_handler_for<unflatten_indices_t<Ks, Vs...>, F, Vs...>...
 			};
 		};
 
-		template <class...Is, class F, Variant...Vs>
+		template <std::size_t...Ks, class F, Variant...Vs>
 		requires RawVisitorWithIndices<F, Vs...>
 		constexpr visit_handler_ptr<F, Vs...>
-			O1_dispatch<meta::list<Is...>, F, Vs...>::table[];
+			O1_dispatch<std::index_sequence<Ks...>, F, Vs...>::table[];
 
 		constexpr std::size_t calc_index() noexcept {
 			return 0;
@@ -278,28 +256,16 @@ STL2_OPEN_NAMESPACE {
 		calc_index(const First& f, const Rest&...rest) noexcept
 		{
 			STL2_ASSUME_CONSTEXPR(f.valid());
-			constexpr std::size_t M = meta::_v<meta::fold<
-				meta::list<meta::size<VariantTypes<Rest>>...>,
-				meta::size_t<1>,
-				meta::quote<meta::multiplies>>>;
-			return f.index() * M + calc_index(rest...);
+			return f.index() * total_indices<Rest...> + calc_index(rest...);
 		}
 
-		template <Variant...Vs>
-		using all_index_vectors =
-			meta::transform<
-				meta::cartesian_product<meta::list<
-					meta::as_list<meta::make_index_sequence<
-						VariantTypes<Vs>::size()>>...>>,
-				meta::quote<__as_integer_sequence>>;
-
 		RawVisitorWithIndices{F, ...Vs}
 		constexpr VisitReturn<F, Vs...>
 		raw_visit_with_indices(F&& f, Vs&&...vs)
 		noexcept(VisitNothrow<F, Vs...>)
-		requires total_alternatives<Vs...> >= O1_visit_threshold
 		{
-			using Dispatch = O1_dispatch<all_index_vectors<Vs...>, F, Vs...>;
+			using Dispatch = O1_dispatch<
+				std::make_index_sequence<total_indices<Vs...>>, F, Vs...>;
 			std::size_t i = calc_index(vs...);
 			STL2_ASSUME_CONSTEXPR(Dispatch::table[i]);
 			return Dispatch::table[i](__stl2::forward<F>(f), __stl2::forward<Vs>(vs)...);
@@ -14,6 +14,15 @@
 
 #include <memory>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/scratch_resource.hpp>
+#include <stl2/detail/memory/addressof.hpp>
+#include <stl2/detail/memory/concepts.hpp>
+#include <stl2/detail/memory/destroy.hpp>
+#include <stl2/detail/memory/uninitialized_copy.hpp>
+#include <stl2/detail/memory/uninitialized_default_construct.hpp>
+#include <stl2/detail/memory/uninitialized_fill.hpp>
+#include <stl2/detail/memory/uninitialized_move.hpp>
+#include <stl2/detail/memory/uninitialized_value_construct.hpp>
 
 STL2_OPEN_NAMESPACE {
 	// pointer traits
@@ -50,11 +59,8 @@ STL2_OPEN_NAMESPACE {
 	using std::return_temporary_buffer;
 
 	// specialized algorithms
-	// addressof defined below
-	using std::uninitialized_copy;
-	using std::uninitialized_copy_n;
-	using std::uninitialized_fill;
-	using std::uninitialized_fill_n;
+	// addressof, destroy, and the uninitialized_* algorithms are defined in
+	// stl2/detail/memory.
 
 	// template class unique_ptr
 	using std::default_delete;
@@ -105,31 +111,6 @@ STL2_OPEN_NAMESPACE {
 	//using std::uses_allocator_v;
 	template <class T, class A>
 	constexpr bool uses_allocator_v = uses_allocator<T, A>::value;
-
-	// addressof
-	namespace __addressof {
-		template <class>
-		constexpr bool __user_defined_addressof = false;
-		template <class T>
-		requires
-			requires(T& t) { t.operator&(); } ||
-			requires(T& t) { operator&(t); }
-		constexpr bool __user_defined_addressof<T> = true;
-
-		template <class T>
-		requires __user_defined_addressof<T>
-		T* impl(T& t) noexcept {
-			return std::addressof(t);
-		}
-
-		constexpr auto impl(auto& t) noexcept {
-			return &t;
-		}
-	}
-	template <class T>
-	constexpr T* addressof(T& t) noexcept {
-		return __addressof::impl(t);
-	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -13,7 +13,9 @@
 #define STL2_RANDOM_HPP
 
 #include <random>
+#include <stl2/detail/alias_table.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/random_engine.hpp>
 #include <stl2/detail/concepts/urng.hpp>
 
 STL2_OPEN_NAMESPACE {
@@ -15,6 +15,7 @@
 #include <utility>
 
 #include <stl2/functional.hpp>
+#include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/in_place.hpp>
 #include <stl2/detail/meta.hpp>
@@ -44,6 +45,40 @@ STL2_OPEN_NAMESPACE {
 	using std::make_index_sequence;
 	using std::index_sequence_for;
 
+	// common_type and common_reference for pairs [Extension]
+	// Distinct pairs of the same two types up to references and cv-qualifiers,
+	// such as the pair of references a zipped iterator yields and the pair of
+	// values it stands for, have the pair of values as their common type.
+	// Their common reference is the pair of values when either is a pair of
+	// values by value, and otherwise the pair of const references, which
+	// binds to both without copying.
+	template <class T1, class T2, class U1, class U2>
+	requires
+		!is_same<pair<T1, T2>, pair<U1, U2>>::value &&
+		is_same<__uncvref<T1>, __uncvref<U1>>::value &&
+		is_same<__uncvref<T2>, __uncvref<U2>>::value
+	struct common_type<pair<T1, T2>, pair<U1, U2>> {
+		using type = pair<__uncvref<T1>, __uncvref<T2>>;
+	};
+
+	template <class T1, class T2, template <class> class Qual>
+	constexpr bool __pair_prvalue =
+		!is_reference<Qual<int>>::value &&
+		!is_reference<T1>::value && !is_reference<T2>::value;
+
+	template <class T1, class T2, class U1, class U2,
+		template <class> class TQual, template <class> class UQual>
+	requires
+		!is_same<pair<T1, T2>, pair<U1, U2>>::value &&
+		is_same<__uncvref<T1>, __uncvref<U1>>::value &&
+		is_same<__uncvref<T2>, __uncvref<U2>>::value
+	struct basic_common_reference<pair<T1, T2>, pair<U1, U2>, TQual, UQual> {
+		using type = meta::if_c<
+			__pair_prvalue<T1, T2, TQual> || __pair_prvalue<U1, U2, UQual>,
+			pair<__uncvref<T1>, __uncvref<T2>>,
+			pair<const __uncvref<T1>&, const __uncvref<T2>&>>;
+	};
+
 	template <class T, class T1, class T2>
 	constexpr std::size_t tuple_find<T, pair<T1, T2>> =
 		meta::_v<meta::find_index<meta::list<T1, T2>, T>>;
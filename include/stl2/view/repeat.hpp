@@ -13,7 +13,6 @@
 #define STL2_DETAIL_VIEW_REPEAT_HPP
 
 #include <stl2/iterator.hpp>
-#include <stl2/memory.hpp>
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/cheap_storage.hpp>
 #include <stl2/detail/ebo_box.hpp>
@@ -21,6 +20,7 @@
 #include <stl2/detail/meta.hpp>
 #include <stl2/detail/concepts/object.hpp>
 #include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/memory/addressof.hpp>
 
 STL2_OPEN_NAMESPACE {
 	template <Semiregular T>
@@ -11,6 +11,7 @@
 //
 #include <stl2/detail/algorithm/copy_if.hpp>
 #include <algorithm>
+#include <vector>
 #include "../simple_test.hpp"
 
 namespace ranges = __stl2;
@@ -101,5 +102,26 @@ int main() {
 		CHECK(std::count(target + n / 2, target + n, -1) == n / 2);
 	}
 
+	{
+		// Parallel overloads
+		std::vector<int> source(1000);
+		for (int i = 0; i < 1000; ++i) {
+			source[i] = (i * 7) % 13;
+		}
+		std::vector<int> expected(1000, -1), target(1000, -1);
+		auto last = std::copy_if(source.begin(), source.end(), expected.begin(), is_even);
+
+		auto res = ranges::copy_if(ranges::ext::parallel_policy{4, 16},
+			source.begin(), source.end(), target.begin(), is_even);
+		CHECK(res.in() == source.end());
+		CHECK((res.out() - target.begin()) == last - expected.begin());
+		CHECK(target == expected);
+
+		std::fill(target.begin(), target.end(), -1);
+		auto res2 = ranges::copy_if(ranges::ext::seq, source, target.begin(), is_even);
+		CHECK((res2.out() - target.begin()) == last - expected.begin());
+		CHECK(target == expected);
+	}
+
 	return test_result();
 }
@@ -10,6 +10,7 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <stl2/detail/algorithm/count.hpp>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -60,5 +61,20 @@ int main()
 	CHECK(count({0, 1, 2, 2, 0, 1, 2, 3}, 2) == 3);
 	CHECK(count({0, 1, 2, 2, 0, 1, 2, 3}, 7) == 0);
 
+	// Parallel overloads
+	{
+		std::vector<int> v(5000);
+		for (int i = 0; i < 5000; ++i) {
+			v[i] = i % 7;
+		}
+		auto pol = ext::parallel_policy{4, 16};
+		CHECK(count(pol, v.begin(), v.end(), 3) == 714);
+		CHECK(count(pol, v, 6) == 714);
+		CHECK(count(pol, v, 0) == 715);
+		CHECK(count(ext::seq, v, 42) == 0);
+		CHECK(count(pol, v.begin(), v.begin(), 0) == 0);
+		CHECK(count(pol, sa, 2, &S::i) == 3);
+	}
+
 	return ::test_result();
 }
@@ -10,6 +10,7 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <stl2/detail/algorithm/count_if.hpp>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -81,5 +82,19 @@ int main()
 	CHECK(count_if({0, 1, 2, 2, 0, 1, 2, 3}, equals(2)) == 3);
 	CHECK(count_if({0, 1, 2, 2, 0, 1, 2, 3}, equals(42)) == 0);
 
+	// Parallel overloads
+	{
+		std::vector<int> v(5000);
+		for (int i = 0; i < 5000; ++i) {
+			v[i] = i % 7;
+		}
+		auto pol = ext::parallel_policy{4, 16};
+		CHECK(count_if(pol, v.begin(), v.end(), equals(3)) == 714);
+		CHECK(count_if(pol, v, [](int i) { return i < 2; }) == 1430);
+		CHECK(count_if(ext::seq, v, equals(42)) == 0);
+		CHECK(count_if(pol, sa, equals(2), &S::i) == 3);
+		CHECK(count_if(pol, ta, &T::b) == 4);
+	}
+
 	return ::test_result();
 }
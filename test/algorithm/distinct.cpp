@@ -0,0 +1,120 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/distinct.hpp>
+#include <stl2/detail/algorithm/distinct_copy.hpp>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../hash_test_types.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+namespace stl2 = __stl2;
+
+namespace {
+	struct S {
+		int i;
+		std::string name;
+	};
+
+	void test_distinct() {
+		std::vector<int> v = {3, 1, 3, 2, 1, 4, 2, 3};
+		auto e = stl2::ext::distinct(v);
+		CHECK((e - v.begin()) == 4);
+		v.erase(e, v.end());
+		::check_equal(v, {3, 1, 2, 4});
+
+		std::vector<int> empty;
+		CHECK(stl2::ext::distinct(empty) == empty.end());
+
+		// Nothing to remove.
+		std::vector<int> d = {5, 4, 3};
+		CHECK(stl2::ext::distinct(d.begin(), d.end()) == d.end());
+		::check_equal(d, {5, 4, 3});
+
+		int a[] = {1, 1, 1, 1};
+		auto ae = stl2::ext::distinct(forward_iterator<int*>(a),
+			sentinel<int*>(a + 4));
+		CHECK(ae.base() == a + 1);
+
+		// Elements are moved, not copied, into place.
+		std::vector<std::unique_ptr<int>> p;
+		for (int i : {1, 2, 1, 3, 2}) {
+			p.push_back(std::make_unique<int>(i));
+		}
+		auto pe = stl2::ext::distinct(p, [](const std::unique_ptr<int>& q) { return *q; });
+		CHECK((pe - p.begin()) == 3);
+		CHECK(*p[0] == 1);
+		CHECK(*p[1] == 2);
+		CHECK(*p[2] == 3);
+
+		std::vector<S> s = {{1, "a"}, {2, "b"}, {1, "c"}, {3, "b"}};
+		auto se = stl2::ext::distinct(s, &S::name);
+		CHECK((se - s.begin()) == 3);
+		CHECK(s[1].i == 2);
+		CHECK(s[2].name == "c");
+
+		// Values equal under operator== but not in every byte.
+		std::vector<Id> ids = {{1, 0}, {2, 0}, {1, 1}, {3, 0}, {2, 7}};
+		auto ie = stl2::ext::distinct(ids);
+		CHECK((ie - ids.begin()) == 3);
+		CHECK(ids[0].v == 1u);
+		CHECK(ids[1].v == 2u);
+		CHECK(ids[2].v == 3u);
+
+		// Large input, many duplicates.
+		std::vector<int> big;
+		for (int i = 0; i < 100000; ++i) {
+			big.push_back((i * 7919) % 1000);
+		}
+		auto be = stl2::ext::distinct(big);
+		CHECK((be - big.begin()) == 1000);
+		CHECK(big[0] == 0);
+		CHECK(big[1] == 919);
+	}
+
+	void test_distinct_copy() {
+		const int a[] = {3, 1, 3, 2, 1, 4, 2, 3};
+		int out[8] = {};
+		auto r = stl2::ext::distinct_copy(input_iterator<const int*>(a),
+			sentinel<const int*>(a + 8), output_iterator<int*>(out));
+		CHECK(r.in().base() == a + 8);
+		CHECK(r.out().base() == out + 4);
+		::check_equal(stl2::ext::make_range(out, out + 4), {3, 1, 2, 4});
+
+		std::list<std::string> l = {"x", "y", "x", "z", "y"};
+		std::vector<std::string> o;
+		stl2::ext::distinct_copy(l, stl2::back_inserter(o));
+		::check_equal(o, {"x", "y", "z"});
+
+		std::vector<S> s = {{1, "a"}, {2, "b"}, {1, "c"}, {3, "b"}};
+		std::vector<S> so;
+		stl2::ext::distinct_copy(s, stl2::back_inserter(so), &S::i);
+		CHECK(so.size() == 3u);
+		CHECK(so[2].name == "b");
+
+		int out2[3] = {};
+		auto r2 = stl2::ext::distinct_copy({2, 2, 1, 2, 1}, out2);
+		CHECK(r2.out() == out2 + 2);
+		::check_equal(stl2::ext::make_range(out2, out2 + 2), {2, 1});
+	}
+}
+
+int main() {
+	test_distinct();
+	test_distinct_copy();
+	return ::test_result();
+}
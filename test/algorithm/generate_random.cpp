@@ -0,0 +1,126 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/generate_random.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	template <class T>
+	double mean(const std::vector<T>& v) {
+		double sum = 0;
+		for (auto x : v) {
+			sum += static_cast<double>(x);
+		}
+		return sum / static_cast<double>(v.size());
+	}
+
+	template <class T>
+	double variance(const std::vector<T>& v) {
+		auto const m = mean(v);
+		double sum = 0;
+		for (auto x : v) {
+			sum += (static_cast<double>(x) - m) * (static_cast<double>(x) - m);
+		}
+		return sum / static_cast<double>(v.size());
+	}
+
+	template <class Gen>
+	void test_int(Gen g) {
+		std::vector<int> v(100001);
+		std::uniform_int_distribution<int> d{-3, 6};
+		CHECK(ranges::ext::generate_random(v, d, g) == v.end());
+		CHECK(*std::min_element(v.begin(), v.end()) == -3);
+		CHECK(*std::max_element(v.begin(), v.end()) == 6);
+		for (int i = -3; i <= 6; ++i) {
+			auto const c = std::count(v.begin(), v.end(), i);
+			CHECK(c > 9400);
+			CHECK(c < 10600);
+		}
+
+		// A range that needs all 64 bits, and one that needs more than 32.
+		std::vector<std::uint64_t> w(10000);
+		std::uniform_int_distribution<std::uint64_t> all;
+		ranges::ext::generate_random(w, all, g);
+		CHECK(std::count(w.begin(), w.end(), w[0]) == 1);
+		std::uniform_int_distribution<std::uint64_t> wide{0, (std::uint64_t{3} << 40) - 1};
+		ranges::ext::generate_random(w, wide, g);
+		CHECK(*std::max_element(w.begin(), w.end()) < (std::uint64_t{3} << 40));
+		CHECK(*std::max_element(w.begin(), w.end()) > (std::uint64_t{2} << 40));
+
+		std::vector<short> s(5000);
+		std::uniform_int_distribution<short> neg{-200, -100};
+		ranges::ext::generate_random(s.begin(), s.end(), neg, g);
+		CHECK(*std::min_element(s.begin(), s.end()) == -200);
+		CHECK(*std::max_element(s.begin(), s.end()) == -100);
+	}
+
+	template <class T, class Gen>
+	void test_real(Gen g) {
+		std::vector<T> v(100003);
+		std::uniform_real_distribution<T> d{T(2), T(4)};
+		ranges::ext::generate_random(v, d, g);
+		CHECK(*std::min_element(v.begin(), v.end()) >= T(2));
+		CHECK(*std::max_element(v.begin(), v.end()) < T(4));
+		CHECK(std::fabs(mean(v) - 3) < 0.01);
+		CHECK(std::fabs(variance(v) - 1.0 / 3) < 0.01);
+	}
+
+	template <class T, class Gen>
+	void test_normal(Gen g) {
+		std::vector<T> v(400000);
+		std::normal_distribution<T> d{T(10), T(2)};
+		ranges::ext::generate_random(v.data(), v.data() + v.size(), d, g);
+		CHECK(std::fabs(mean(v) - 10) < 0.02);
+		CHECK(std::fabs(variance(v) - 4) < 0.05);
+		// Tail mass beyond 3 sigma is 0.0027.
+		auto const tails = std::count_if(v.begin(), v.end(),
+			[](T x) { return std::fabs(x - 10) > 6; });
+		CHECK(tails > 900);
+		CHECK(tails < 1260);
+		// Mass within one sigma is 0.6827.
+		auto const inner = std::count_if(v.begin(), v.end(),
+			[](T x) { return std::fabs(x - 10) < 2; });
+		CHECK(inner > 271000);
+		CHECK(inner < 275200);
+	}
+}
+
+int main() {
+	test_int(ranges::ext::xoshiro256pp{1});
+	test_int(std::mt19937{2});
+	test_real<double>(ranges::ext::xoshiro256pp{3});
+	test_real<float>(ranges::ext::splitmix64{4});
+	test_normal<double>(ranges::ext::xoshiro256pp{5});
+	test_normal<float>(std::mt19937_64{6});
+
+	// Anything else is a loop of dist(gen).
+	{
+		std::minstd_rand g;
+		std::list<double> l(1000);
+		std::exponential_distribution<double> d{2.0};
+		CHECK(ranges::ext::generate_random(l, d, g) == l.end());
+		CHECK(std::all_of(l.begin(), l.end(), [](double x) { return x >= 0; }));
+		std::vector<int> v(1000);
+		std::uniform_int_distribution<int> u{1, 6};
+		ranges::ext::generate_random(v, u, g);
+		CHECK(*std::min_element(v.begin(), v.end()) == 1);
+		CHECK(*std::max_element(v.begin(), v.end()) == 6);
+	}
+	return ::test_result();
+}
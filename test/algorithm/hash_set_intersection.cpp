@@ -0,0 +1,88 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/hash_set_intersection.hpp>
+#include <stl2/detail/algorithm/set_intersection.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../hash_test_types.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+namespace stl2 = __stl2;
+
+namespace {
+	struct S {
+		int i;
+	};
+	struct T {
+		int i;
+		std::string s;
+	};
+}
+
+int main() {
+	{
+		const int a[] = {4, 1, 2, 2, 3, 2, 7};
+		const int b[] = {2, 9, 4, 2, 5};
+		int out[7] = {};
+		auto r = stl2::ext::hash_set_intersection(
+			input_iterator<const int*>(a), sentinel<const int*>(a + 7),
+			input_iterator<const int*>(b), sentinel<const int*>(b + 5),
+			output_iterator<int*>(out));
+		CHECK(r.base() == out + 3);
+		// First range order; each value at most as often as in the second.
+		::check_equal(stl2::ext::make_range(out, out + 3), {4, 2, 2});
+	}
+	{
+		std::vector<int> a, b, got, want;
+		for (int i = 0; i < 5000; ++i) {
+			a.push_back((i * 7919) % 613);
+			b.push_back((i * 104729) % 997);
+		}
+		stl2::ext::hash_set_intersection(a, b, stl2::back_inserter(got));
+		stl2::sort(a);
+		stl2::sort(b);
+		stl2::set_intersection(a, b, stl2::back_inserter(want));
+		stl2::sort(got);
+		CHECK(got == want);
+	}
+	{
+		std::vector<S> a = {{1}, {2}, {3}, {2}};
+		std::vector<T> b = {{2, "two"}, {3, "three"}};
+		std::vector<S> out;
+		stl2::ext::hash_set_intersection(a, b, stl2::back_inserter(out), &S::i, &T::i);
+		CHECK(out.size() == 2u);
+		CHECK(out[0].i == 2);
+		CHECK(out[1].i == 3);
+	}
+	{
+		std::vector<std::string> a = {"pear", "fig", "apple"};
+		std::vector<std::string> b;
+		std::vector<std::string> out;
+		stl2::ext::hash_set_intersection(a, b, stl2::back_inserter(out));
+		CHECK(out.empty());
+	}
+	{
+		// Values equal under operator== but not in every byte.
+		std::vector<Id> a = {{1, 1}, {2, 0}, {1, 2}};
+		std::vector<Id> b = {{1, 5}, {1, 6}, {3, 0}};
+		std::vector<Id> out;
+		stl2::ext::hash_set_intersection(a, b, stl2::back_inserter(out));
+		CHECK(out == (std::vector<Id>{{1, 1}, {1, 2}}));
+	}
+
+	return ::test_result();
+}
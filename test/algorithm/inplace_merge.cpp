@@ -21,7 +21,11 @@
 #include <stl2/detail/algorithm/inplace_merge.hpp>
 #include <cassert>
 #include <algorithm>
+#include <numeric>
 #include <random>
+#include <string>
+#include <utility>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -127,6 +131,52 @@ test()
 	test<Iter>(1000);
 }
 
+// Move construction may throw, which keeps the parallel overload from
+// staging elements through a buffer.
+struct throwing_move {
+	int key, id;
+	throwing_move(int k, int i) : key{k}, id{i} {}
+	throwing_move(throwing_move&& that) noexcept(false)
+	: key{that.key}, id{that.id} {}
+	throwing_move& operator=(throwing_move&&) = default;
+};
+
+template <class T, class EP>
+void test_stable(EP pol, unsigned N, unsigned M)
+{
+	std::vector<T> v;
+	for (unsigned i = 0; i < N; ++i) {
+		v.emplace_back(static_cast<int>((i < M ? i : i - M) / 7), static_cast<int>(i));
+	}
+	auto expected = std::vector<int>(N);
+	std::iota(expected.begin(), expected.end(), 0);
+	std::stable_sort(expected.begin(), expected.end(), [&](int a, int b) {
+		return v[a].key < v[b].key;
+	});
+
+	auto ids = [](const std::vector<T>& v) {
+		std::vector<int> r;
+		for (auto& t : v) {
+			r.push_back(t.id);
+		}
+		return r;
+	};
+
+	auto w = std::vector<T>{};
+	for (auto& t : v) {
+		w.emplace_back(t.key, t.id);
+	}
+	CHECK(stl2::inplace_merge(pol, v, v.begin() + M, std::less<int>{}, &T::key) == v.end());
+	CHECK(ids(v) == expected);
+	stl2::inplace_merge(w, w.begin() + M, std::less<int>{}, &T::key);
+	CHECK(ids(w) == expected);
+}
+
+struct pair_key {
+	int key, id;
+	pair_key(int k, int i) : key{k}, id{i} {}
+};
+
 int main()
 {
 	// test<forward_iterator<int*> >();
@@ -134,5 +184,49 @@ int main()
 	test<random_access_iterator<int*> >();
 	test<int*>();
 
+	// Parallel overloads; equivalent elements keep their relative order.
+	{
+		auto pol = stl2::ext::parallel_policy{4, 16};
+		test_stable<pair_key>(pol, 5000, 1700);
+		test_stable<pair_key>(pol, 5000, 4999);
+		test_stable<pair_key>(pol, 5000, 0);
+		test_stable<pair_key>(stl2::ext::seq, 1000, 300);
+		test_stable<throwing_move>(pol, 5000, 1700);
+		test_stable<throwing_move>(pol, 5000, 3300);
+
+		std::vector<int> v(3000);
+		for (int i = 0; i < 3000; ++i) {
+			v[i] = i < 1000 ? 3 * i : (i - 1000) * 3 / 2;
+		}
+		stl2::inplace_merge(pol, v.begin(), v.begin() + 1000, v.end());
+		CHECK(std::is_sorted(v.begin(), v.end()));
+	}
+
+	// The parallel merge out of the buffer reads no element it has moved
+	// from, even through a projection that takes its argument by value.
+	{
+		std::vector<std::string> v, expected;
+		for (int i = 0; i < 4000; ++i) {
+			auto s = std::to_string(100000 + (i < 1500 ? 2 * i : 2 * (i - 1500) + 1));
+			v.push_back(s + std::string(24, '.'));
+		}
+		expected = v;
+		std::inplace_merge(expected.begin(), expected.begin() + 1500, expected.end());
+		auto key = [](std::string s) { return s; };
+		stl2::inplace_merge(stl2::ext::parallel_policy{4, 16}, v, v.begin() + 1500,
+			std::less<std::string>{}, key);
+		CHECK(v == expected);
+	}
+
+	// The tail of the run left in place is not moved onto itself.
+	{
+		std::vector<std::string> v = {"b", "d", "a", "c", "e", "f"};
+		stl2::inplace_merge(v, v.begin() + 2);
+		::check_equal(v, {"a", "b", "c", "d", "e", "f"});
+		v = {"a", "b", "e", "f", "c", "d"};
+		stl2::inplace_merge(v, v.begin() + 4);
+		::check_equal(v, {"a", "b", "c", "d", "e", "f"});
+	}
+
 	return ::test_result();
 }
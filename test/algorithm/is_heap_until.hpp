@@ -26,6 +26,7 @@
 //   http://http://libcxx.llvm.org/
 
 #include <stl2/detail/algorithm/is_heap_until.hpp>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -1072,5 +1073,34 @@ int main()
 	auto res = stl2::is_heap_until(stl2::move(i185), std::greater<int>(), &S::i);
 	CHECK(res.get_unsafe() == i185+1);
 
+	// Parallel overloads report the first violating child:
+	{
+		auto pol = stl2::ext::parallel_policy{4, 16};
+		std::vector<int> v(5000);
+		for (int i = 0; i < 5000; ++i) {
+			v[i] = 5000 - i;
+		}
+		CHECK(stl2::is_heap_until(pol, v) == v.end());
+		CHECK(stl2::is_heap_until(stl2::ext::seq, v.begin(), v.end()) == v.end());
+		for (int i : {1, 2, 64, 1249, 1250, 2500, 4999}) {
+			auto w = v;
+			w[i] = 10000 + i;
+			w[4000] = 20000;
+			CHECK(stl2::is_heap_until(pol, w) == stl2::is_heap_until(w));
+			CHECK(stl2::is_heap_until(pol, w.begin(), w.end()) != w.end());
+		}
+		CHECK(stl2::is_heap_until(pol, v, std::greater<int>()) ==
+			stl2::is_heap_until(v, std::greater<int>()));
+
+		std::vector<S> vs(5000);
+		for (int i = 0; i < 5000; ++i) {
+			vs[i].i = i;
+		}
+		CHECK(stl2::is_heap_until(pol, vs, std::greater<int>(), &S::i) == vs.end());
+		vs[3000].i = 0;
+		CHECK(stl2::is_heap_until(pol, vs, std::greater<int>(), &S::i) ==
+			vs.begin() + 3000);
+	}
+
 	return ::test_result();
 }
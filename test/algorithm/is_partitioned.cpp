@@ -25,6 +25,7 @@
 #include <stl2/detail/algorithm/is_partitioned.hpp>
 #include <memory>
 #include <utility>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -125,5 +126,33 @@ int main()
 	const S ia[] = {S{1}, S{3}, S{5}, S{2}, S{4}, S{6}};
 	CHECK( stl2::is_partitioned(ia, is_odd(), &S::i) );
 
+	// Parallel overloads
+	{
+		auto pol = stl2::ext::parallel_policy{4, 16};
+		std::vector<int> v(5000);
+		for (int i = 0; i < 5000; ++i) {
+			v[i] = i < 1250 ? 2 * i + 1 : 2 * i;
+		}
+		CHECK(stl2::is_partitioned(pol, v, is_odd()));
+		CHECK(stl2::is_partitioned(stl2::ext::seq, v.begin(), v.end(), is_odd()));
+		v[1251] = 1;
+		CHECK(!stl2::is_partitioned(pol, v, is_odd()));
+		v[1251] = 2;
+		v[4999] = 1;
+		CHECK(!stl2::is_partitioned(pol, v, is_odd()));
+		v[4999] = 2;
+		v[1000] = 2;
+		CHECK(!stl2::is_partitioned(pol, v, is_odd()));
+		for (auto& i : v) {
+			i = 2;
+		}
+		CHECK(stl2::is_partitioned(pol, v, is_odd()));
+		for (auto& i : v) {
+			i = 1;
+		}
+		CHECK(stl2::is_partitioned(pol, v, is_odd()));
+		CHECK(stl2::is_partitioned(pol, std::vector<S>(5000, S{1}), is_odd(), &S::i));
+	}
+
 	return ::test_result();
 }
@@ -24,7 +24,15 @@
 
 #include <stl2/utility.hpp>
 #include <stl2/detail/algorithm/is_permutation.hpp>
+#include <stl2/detail/scratch_resource.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
 #include "../simple_test.hpp"
+#include "../hash_test_types.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
@@ -49,6 +57,86 @@ struct T
 	int i;
 };
 
+// StrictTotallyOrdered but not hashable.
+struct ordered
+{
+	int i;
+	double d;
+
+	friend bool operator==(const ordered& a, const ordered& b) { return a.i == b.i && a.d == b.d; }
+	friend bool operator!=(const ordered& a, const ordered& b) { return !(a == b); }
+	friend bool operator<(const ordered& a, const ordered& b) { return a.i < b.i || (a.i == b.i && a.d < b.d); }
+	friend bool operator>(const ordered& a, const ordered& b) { return b < a; }
+	friend bool operator<=(const ordered& a, const ordered& b) { return !(b < a); }
+	friend bool operator>=(const ordered& a, const ordered& b) { return !(a < b); }
+};
+
+void test_large()
+{
+	// Large enough to take the hashing and sorting paths.
+	std::vector<int> a;
+	for (int i = 0; i < 2000; ++i) {
+		a.push_back((i * 7919) % 301);
+	}
+	std::vector<int> b = a;
+	std::reverse(b.begin(), b.end());
+	std::rotate(b.begin(), b.begin() + 700, b.end());
+	CHECK(stl2::is_permutation(a, b));
+	std::list<int> l(b.begin(), b.end());
+	CHECK(stl2::is_permutation(a.begin(), a.end(), l.begin(), l.end()));
+	// Same values, different multiplicities.
+	b.back() = b.front();
+	CHECK(!stl2::is_permutation(a, b));
+	b.back() = 1000;
+	CHECK(!stl2::is_permutation(a, b));
+
+	std::vector<std::string> sa, sb;
+	for (int i = 0; i < 500; ++i) {
+		sa.push_back(std::to_string(i % 97));
+	}
+	sb.assign(sa.rbegin(), sa.rend());
+	CHECK(stl2::is_permutation(sa, sb));
+	sb[10] += "x";
+	CHECK(!stl2::is_permutation(sa, sb));
+
+	std::vector<S> ss;
+	std::vector<T> ts;
+	for (int i = 0; i < 200; ++i) {
+		ss.push_back(S{i % 13});
+		ts.push_back(T{(199 - i) % 13});
+	}
+	CHECK(stl2::is_permutation(ss, ts, stl2::equal_to<>{}, &S::i, &T::i));
+	ts[0].i = 14;
+	CHECK(!stl2::is_permutation(ss, ts, stl2::equal_to<>{}, &S::i, &T::i));
+
+	std::vector<ordered> oa, ob;
+	for (int i = 0; i < 300; ++i) {
+		oa.push_back(ordered{i % 17, (i % 3) * 0.5});
+	}
+	ob.assign(oa.rbegin(), oa.rend());
+	CHECK(stl2::is_permutation(oa, ob));
+	ob[5].d += 1;
+	CHECK(!stl2::is_permutation(oa, ob));
+
+	// Equal values that differ in bytes the equality ignores.
+	std::vector<Id> ia, ib;
+	for (std::uint32_t i = 0; i < 100; ++i) {
+		ia.push_back(Id{i % 23, 0});
+		ib.push_back(Id{(99 - i) % 23, i});
+	}
+	CHECK(stl2::is_permutation(ia, ib, stl2::equal_to<>{}));
+	ib[0].v = 24;
+	CHECK(!stl2::is_permutation(ia, ib, stl2::equal_to<>{}));
+
+	// Without room for the copies, the quadratic scan still answers.
+	stl2::ext::monotonic_scratch_resource none{nullptr, 0};
+	stl2::ext::scoped_scratch_resource _{none};
+	ob.assign(oa.rbegin(), oa.rend());
+	CHECK(stl2::is_permutation(oa, ob));
+	ob[5].d += 1;
+	CHECK(!stl2::is_permutation(oa, ob));
+}
+
 int main()
 {
 	{
@@ -849,5 +937,7 @@ int main()
 								   std::equal_to<int const>(), &S::i, &T::i) == false);
 	}
 
+	test_large();
+
 	return ::test_result();
 }
@@ -27,6 +27,7 @@
 //   http://http://libcxx.llvm.org/
 
 #include <stl2/detail/algorithm/is_sorted.hpp>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -391,5 +392,19 @@ int main()
 		CHECK(!ranges::is_sorted(as, std::greater<int>{}, &A::a));
 	}
 
+	/// Parallel overloads:
+	{
+		auto pol = ranges::ext::parallel_policy{4, 16};
+		std::vector<int> v(5000);
+		for (int i = 0; i < 5000; ++i) {
+			v[i] = i;
+		}
+		CHECK(ranges::is_sorted(pol, v));
+		CHECK(ranges::is_sorted(ranges::ext::seq, v.begin(), v.end()));
+		v[2500] = 0;
+		CHECK(!ranges::is_sorted(pol, v));
+		CHECK(!ranges::is_sorted(pol, v.begin(), v.end()));
+	}
+
 	return ::test_result();
 }
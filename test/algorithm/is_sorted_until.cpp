@@ -27,6 +27,7 @@
 //   http://http://libcxx.llvm.org/
 
 #include <stl2/detail/algorithm/is_sorted_until.hpp>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -406,5 +407,34 @@ int main()
 		CHECK(stl2::is_sorted_until(stl2::move(as), std::greater<int>{}, &A::a).get_unsafe() == stl2::next(stl2::begin(as),1));
 	}
 
+	/// Parallel overloads report the first descent, wherever the chunks split:
+	{
+		auto pol = stl2::ext::parallel_policy{4, 16};
+		std::vector<int> v(5000);
+		for (int i = 0; i < 5000; ++i) {
+			v[i] = i / 3;
+		}
+		CHECK(stl2::is_sorted_until(pol, v) == v.end());
+		CHECK(stl2::is_sorted_until(stl2::ext::seq, v.begin(), v.end()) == v.end());
+		for (int i : {1, 63, 64, 1249, 1250, 1251, 2500, 4999}) {
+			auto w = v;
+			w[i] = -1;
+			w[i + (i < 4000 ? 1000 : -500)] = -2;
+			auto expected = stl2::is_sorted_until(w);
+			CHECK(stl2::is_sorted_until(pol, w) == expected);
+			CHECK(stl2::is_sorted_until(pol, w, std::greater<int>{}) ==
+				stl2::is_sorted_until(w, std::greater<int>{}));
+		}
+
+		std::vector<A> as(5000);
+		for (int i = 0; i < 5000; ++i) {
+			as[i].a = v[i];
+		}
+		as[3001].a = 0;
+		CHECK(stl2::is_sorted_until(pol, as, std::less<int>{}, &A::a) ==
+			as.begin() + 3001);
+		CHECK(stl2::is_sorted_until(pol, v.begin(), v.begin()) == v.begin());
+	}
+
 	return ::test_result();
 }
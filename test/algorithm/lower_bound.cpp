@@ -52,6 +52,22 @@ int main()
 	CHECK(stl2::ext::lower_bound_n(begin(a), size(a), a[1], less<>()) == &a[1]);
 	CHECK(stl2::ext::lower_bound_n(begin(a), size(a), 1, less<>(), &std::pair<int, int>::first) == &a[2]);
 
+	CHECK(stl2::ext::branchless_lower_bound_n(begin(a), size(a), a[0]) == &a[0]);
+	CHECK(stl2::ext::branchless_lower_bound_n(begin(a), size(a), a[1], less<>()) == &a[1]);
+	CHECK(stl2::ext::branchless_lower_bound_n(begin(a), size(a), 1, less<>(), &std::pair<int, int>::first) == &a[2]);
+	CHECK(stl2::ext::branchless_lower_bound_n(begin(a), 0, a[0]) == &a[0]);
+	CHECK(stl2::ext::branchless_lower_bound(a, 4, less<>(), &std::pair<int, int>::first) == end(a));
+	CHECK(stl2::ext::branchless_lower_bound(c, 3, less<>(), &std::pair<int, int>::first) == &c[4]);
+	for (int n = 0; n < 40; ++n) {
+		std::vector<int> v;
+		for (int i = 0; i < n; ++i) {
+			v.push_back(2 * i);
+		}
+		for (int k = -1; k <= 2 * n; ++k) {
+			CHECK(stl2::ext::branchless_lower_bound(v, k) == stl2::lower_bound(v, k));
+		}
+	}
+
 	CHECK(stl2::lower_bound(begin(a), end(a), a[0]) == &a[0]);
 	CHECK(stl2::lower_bound(begin(a), end(a), a[1], less<>()) == &a[1]);
 	CHECK(stl2::lower_bound(begin(a), end(a), 1, less<>(), &std::pair<int, int>::first) == &a[2]);
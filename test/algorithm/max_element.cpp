@@ -23,6 +23,7 @@
 #include <numeric>
 #include <random>
 #include <algorithm>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -169,5 +170,28 @@ int main()
 	S const *ps = stl2::max_element(s, std::less<int>{}, &S::i);
 	CHECK(ps->i == 40);
 
+	// Parallel overloads: ties resolve exactly as in the sequential version,
+	// which returns the last maximum.
+	{
+		std::vector<int> v(5000);
+		for (int i = 0; i < 5000; ++i) {
+			v[i] = (i * 7919) % 61;
+		}
+		auto pol = stl2::ext::parallel_policy{4, 16};
+		CHECK(stl2::max_element(pol, v.begin(), v.end()) == stl2::max_element(v));
+		CHECK(stl2::max_element(pol, v) == stl2::max_element(v));
+		CHECK(stl2::max_element(stl2::ext::seq, v) == stl2::max_element(v));
+		CHECK(stl2::max_element(pol, v, std::greater<int>{}) ==
+			stl2::max_element(v, std::greater<int>{}));
+
+		std::vector<S> vs(5000);
+		for (int i = 0; i < 5000; ++i) {
+			vs[i].i = v[i];
+		}
+		CHECK((stl2::max_element(pol, vs, std::less<int>{}, &S::i) - vs.begin()) ==
+			(stl2::max_element(vs, std::less<int>{}, &S::i) - vs.begin()));
+		CHECK(stl2::max_element(pol, v.begin(), v.begin()) == v.begin());
+	}
+
 	return test_result();
 }
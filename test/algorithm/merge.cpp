@@ -16,7 +16,9 @@
 #include <stl2/detail/algorithm/merge.hpp>
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 #include "../simple_test.hpp"
 
 namespace stl2 = __stl2;
@@ -83,5 +85,63 @@ int main()
 		CHECK(std::is_sorted(ic.get(), ic.get() + 2 * N));
 	}
 
+	// Equivalent elements are taken from the first range first.
+	{
+		using P = std::pair<int, int>;
+		std::vector<P> a = {{0, 0}, {1, 0}, {1, 1}, {3, 0}};
+		std::vector<P> b = {{1, 2}, {2, 0}, {3, 1}};
+		std::vector<P> c(7);
+		stl2::merge(a, b, c.begin(), stl2::less<>{}, &P::first, &P::first);
+		CHECK(c == (std::vector<P>{{0, 0}, {1, 0}, {1, 1}, {1, 2}, {2, 0}, {3, 0}, {3, 1}}));
+	}
+	{
+		using P = std::pair<int, int>;
+		std::vector<P> a(1000), b(1500), c1(2500), c2(2500);
+		for (int i = 0; i < 1000; ++i) {
+			a[i] = {i / 40, i};
+		}
+		for (int i = 0; i < 1500; ++i) {
+			b[i] = {i / 60, 1000 + i};
+		}
+		stl2::merge(a, b, c1.begin(), stl2::less<>{}, &P::first, &P::first);
+		stl2::merge(stl2::ext::parallel_policy{4, 16}, a, b, c2.begin(),
+			stl2::less<>{}, &P::first, &P::first);
+		CHECK(std::is_sorted(c1.begin(), c1.end()));
+		CHECK(c1 == c2);
+	}
+
+	// Parallel merge
+	{
+		std::vector<int> a(1000), b(1500), c1(2500), c2(2500);
+		for (int i = 0; i < 1000; ++i) {
+			a[i] = i / 4;
+		}
+		for (int i = 0; i < 1500; ++i) {
+			b[i] = i / 3;
+		}
+		auto r1 = stl2::merge(a, b, c1.begin());
+		auto r2 = stl2::merge(stl2::ext::parallel_policy{4, 16}, a, b, c2.begin());
+		CHECK(std::get<0>(r2) == a.end());
+		CHECK(std::get<1>(r2) == b.end());
+		CHECK(std::get<2>(r2) == c2.end());
+		CHECK(std::get<2>(r1) == c1.end());
+		CHECK(c1 == c2);
+	}
+
+	// Parallel merge of elements that are not trivially copyable.
+	{
+		std::vector<std::string> a, b, expected;
+		for (int i = 0; i < 3000; ++i) {
+			auto s = std::to_string(100000 + i / 2) + std::string(24, '.');
+			(i % 3 ? a : b).push_back(s);
+			expected.push_back(s);
+		}
+		std::vector<std::string> c(expected.size());
+		auto key = [](std::string s) { return s; };
+		stl2::merge(stl2::ext::parallel_policy{4, 16}, a, b, c.begin(),
+			std::less<std::string>{}, key, key);
+		CHECK(c == expected);
+	}
+
 	return ::test_result();
 }
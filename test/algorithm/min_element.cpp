@@ -23,6 +23,7 @@
 #include <random>
 #include <numeric>
 #include <algorithm>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -169,5 +170,27 @@ int main()
 	S const *ps = stl2::min_element(s, std::less<int>{}, &S::i);
 	CHECK(ps->i == -4);
 
+	// Parallel overloads: ties resolve exactly as in the sequential version.
+	{
+		std::vector<int> v(5000);
+		for (int i = 0; i < 5000; ++i) {
+			v[i] = (i * 7919) % 61;
+		}
+		auto pol = stl2::ext::parallel_policy{4, 16};
+		CHECK(stl2::min_element(pol, v.begin(), v.end()) == std::min_element(v.begin(), v.end()));
+		CHECK(stl2::min_element(pol, v) == std::min_element(v.begin(), v.end()));
+		CHECK(stl2::min_element(stl2::ext::seq, v) == std::min_element(v.begin(), v.end()));
+		CHECK(stl2::min_element(pol, v, std::greater<int>{}) ==
+			stl2::min_element(v, std::greater<int>{}));
+
+		std::vector<S> vs(5000);
+		for (int i = 0; i < 5000; ++i) {
+			vs[i].i = v[i];
+		}
+		CHECK((stl2::min_element(pol, vs, std::less<int>{}, &S::i) - vs.begin()) ==
+			(stl2::min_element(vs, std::less<int>{}, &S::i) - vs.begin()));
+		CHECK(stl2::min_element(pol, v.begin(), v.begin()) == v.begin());
+	}
+
 	return test_result();
 }
@@ -23,6 +23,7 @@
 #include <numeric>
 #include <random>
 #include <algorithm>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -228,5 +229,38 @@ int main()
 	CHECK(ps.first->i == -4);
 	CHECK(ps.second->i == 40);
 
+	// Parallel overloads: first minimum and last maximum, as in the
+	// sequential version.
+	{
+		std::vector<int> v(5000);
+		for (int i = 0; i < 5000; ++i) {
+			v[i] = (i * 7919) % 61;
+		}
+		auto pol = stl2::ext::parallel_policy{4, 16};
+		auto expected = stl2::minmax_element(v);
+		auto res = stl2::minmax_element(pol, v.begin(), v.end());
+		CHECK(res.min() == std::min_element(v.begin(), v.end()));
+		CHECK(res.min() == expected.min());
+		CHECK(res.max() == expected.max());
+		CHECK(*res.max() == 60);
+		CHECK(std::count(res.max() + 1, v.end(), 60) == 0);
+		res = stl2::minmax_element(stl2::ext::seq, v);
+		CHECK(res.min() == expected.min());
+		CHECK(res.max() == expected.max());
+		res = stl2::minmax_element(pol, v, std::greater<int>{});
+		expected = stl2::minmax_element(v, std::greater<int>{});
+		CHECK(res.min() == expected.min());
+		CHECK(res.max() == expected.max());
+
+		std::vector<S> vs(5000);
+		for (int i = 0; i < 5000; ++i) {
+			vs[i].i = v[i];
+		}
+		auto ps = stl2::minmax_element(pol, vs, std::less<int>{}, &S::i);
+		auto es = stl2::minmax_element(vs, std::less<int>{}, &S::i);
+		CHECK(ps.min() == es.min());
+		CHECK(ps.max() == es.max());
+	}
+
 	return test_result();
 }
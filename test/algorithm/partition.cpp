@@ -23,7 +23,9 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/partition.hpp>
+#include <algorithm>
 #include <memory>
+#include <vector>
 #include <utility>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -213,5 +215,22 @@ int main()
 	for (S* i = r2.get_unsafe(); i < ia+sa; ++i)
 		CHECK(!is_odd()(i->i));
 
+	// Test parallel overloads
+	{
+		std::vector<int> v(1000);
+		for (int i = 0; i < 1000; ++i) {
+			v[i] = (i * 7) % 13;
+		}
+		auto sorted = v;
+		std::sort(sorted.begin(), sorted.end());
+
+		auto r3 = stl2::partition(stl2::ext::parallel_policy{4, 16}, v, is_odd());
+		CHECK((r3 - v.begin()) == std::count_if(v.begin(), v.end(), is_odd()));
+		CHECK(std::is_partitioned(v.begin(), v.end(), is_odd()));
+		std::sort(v.begin(), v.end());
+		CHECK(v == sorted);
+	}
+
+
 	return ::test_result();
 }
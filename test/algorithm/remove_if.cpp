@@ -27,9 +27,13 @@
 #include <memory>
 #include <utility>
 #include <functional>
+#include <algorithm>
+#include <iterator>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
+#include "../throwing_assign.hpp"
 
 namespace stl2 = __stl2;
 
@@ -191,5 +195,36 @@ int main()
 		CHECK(ia[5].i == 4);
 	}
 
+	{
+		// Parallel overloads
+		std::vector<int> v(1000), expected;
+		for (int i = 0; i < 1000; ++i) {
+			v[i] = i < 100 ? 1 : (i * 7) % 13;
+		}
+		auto pred = [](int i) { return i % 3 == 0; };
+		std::copy_if(v.begin(), v.end(), std::back_inserter(expected),
+			[&](int i) { return !pred(i); });
+
+		auto r = stl2::remove_if(stl2::ext::parallel_policy{4, 16}, v, pred);
+		CHECK((r - v.begin()) == static_cast<std::ptrdiff_t>(expected.size()));
+		CHECK(std::equal(v.begin(), r, expected.begin()));
+	}
+
+	{
+		// A throwing move assignment leaves no element behind in a buffer.
+		{
+			std::vector<throwing_assign> v;
+			for (int i = 0; i < 1000; ++i) {
+				v.emplace_back(i < 500 && i % 2 == 0 ? 0 : (i == 900 ? -1 : 1));
+			}
+			try {
+				stl2::remove_if(stl2::ext::parallel_policy{4, 16}, v,
+					[](int i) { return i == 0; }, &throwing_assign::i);
+				CHECK(false);
+			} catch (int) {}
+		}
+		CHECK(throwing_assign::live() == 0);
+	}
+
 	return ::test_result();
 }
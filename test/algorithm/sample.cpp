@@ -27,6 +27,7 @@
 
 #include <array>
 #include <numeric>
+#include <random>
 #include <stl2/detail/algorithm/equal.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -276,5 +277,37 @@ int main()
 		}
 	}
 
+	// Test the reservoir for unsized input ranges
+	{
+		int data[20];
+		std::iota(data, data + 20, 0);
+		int counts[20] = {};
+		int out[3];
+		std::mt19937 g;
+		for (int t = 0; t < 60000; ++t) {
+			auto result = ranges::sample(input_iterator<int*>(data),
+				sentinel<int*>(data + 20), out, 3, g);
+			CHECK(result.in().base() == data + 20);
+			CHECK(result.out() == out + 3);
+			CHECK(out[0] != out[1]);
+			CHECK(out[0] != out[2]);
+			CHECK(out[1] != out[2]);
+			for (int i : out) {
+				++counts[i];
+			}
+		}
+		// Each element should be picked about 9000 times.
+		for (int c : counts) {
+			CHECK(c > 8400);
+			CHECK(c < 9600);
+		}
+
+		int big[5];
+		auto result = ranges::sample(input_iterator<int*>(data),
+			sentinel<int*>(data + 3), big, 5, g);
+		CHECK(result.in().base() == data + 3);
+		CHECK(ranges::equal(big, big + 3, data, data + 3));
+	}
+
 	return ::test_result();
 }
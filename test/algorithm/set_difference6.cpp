@@ -12,6 +12,7 @@
 
 #include "set_difference.hpp"
 #include <stl2/detail/algorithm/lexicographical_compare.hpp>
+#include <vector>
 
 int main()
 {
@@ -63,5 +64,21 @@ int main()
 		CHECK(stl2::lexicographical_compare(ic, res2.second, ir, irr+srr, std::less<int>(), &U::k) == 0);
 	}
 
+	// Parallel overloads
+	{
+		std::vector<int> a(1000), b(1500), c1(2500), c2(2500);
+		for (int i = 0; i < 1000; ++i) {
+			a[i] = i / 4;
+		}
+		for (int i = 0; i < 1500; ++i) {
+			b[i] = i / 3 + 100;
+		}
+		auto r1 = stl2::set_difference(a, b, c1.begin());
+		auto r2 = stl2::set_difference(stl2::ext::parallel_policy{4, 16}, a, b, c2.begin());
+		CHECK((r2.out() - c2.begin()) == (r1.out() - c1.begin()));
+		CHECK(c1 == c2);
+	}
+
+
 	return ::test_result();
 }
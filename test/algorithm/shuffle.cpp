@@ -24,10 +24,13 @@
 
 #include <stl2/detail/algorithm/equal.hpp>
 #include <stl2/detail/algorithm/shuffle.hpp>
+#include <algorithm>
 #include <numeric>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
+#include "../throwing_assign.hpp"
 
 namespace stl2 = __stl2;
 
@@ -68,5 +71,50 @@ int main()
 		CHECK(!stl2::equal(ia, orig));
 	}
 
+	// Test parallel overloads
+	{
+		// Large enough for several cache-sized buckets.
+		constexpr int n = 1 << 20;
+		std::vector<int> v(n);
+		std::iota(v.begin(), v.end(), 0);
+		stl2::ext::xoshiro256pp g{7};
+		CHECK(stl2::shuffle(stl2::ext::parallel_policy{4, 16}, v, g) == v.end());
+		// About a quarter of the first quarter should stay there.
+		auto const stayed = std::count_if(v.begin(), v.begin() + n / 4,
+			[](int i) { return i < n / 4; });
+		CHECK(stayed > n / 16 - n / 64);
+		CHECK(stayed < n / 16 + n / 64);
+		auto w = v;
+		CHECK(stl2::shuffle(stl2::ext::seq, w.begin(), w.end(), g) == w.end());
+		CHECK(w != v);
+		std::sort(v.begin(), v.end());
+		std::sort(w.begin(), w.end());
+		for (int i = 0; i < n; ++i) {
+			CHECK(v[i] == i);
+			CHECK(w[i] == i);
+		}
+
+		std::vector<int> small(100);
+		std::iota(small.begin(), small.end(), 0);
+		stl2::shuffle(stl2::ext::par, small, g);
+		CHECK(std::is_permutation(small.begin(), small.end(), v.begin()));
+	}
+
+	{
+		// Elements whose move assignment may throw are shuffled in place.
+		constexpr int n = 1 << 20;
+		std::vector<throwing_assign> v;
+		for (int i = 0; i < n; ++i) {
+			v.emplace_back(i);
+		}
+		stl2::ext::xoshiro256pp g{11};
+		CHECK(stl2::shuffle(stl2::ext::parallel_policy{4, 16}, v, g) == v.end());
+		std::vector<bool> seen(n);
+		for (auto& e : v) {
+			seen[e.i] = true;
+		}
+		CHECK(std::count(seen.begin(), seen.end(), true) == n);
+	}
+
 	return ::test_result();
 }
@@ -25,9 +25,11 @@
 #include <stl2/detail/algorithm/stable_partition.hpp>
 #include <memory>
 #include <utility>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
+#include "../throwing_assign.hpp"
 
 namespace ranges = __stl2;
 
@@ -374,6 +376,38 @@ struct S
 	std::pair<int,int> p;
 };
 
+// Move construction may throw, which keeps the parallel overload from
+// staging elements through a buffer.
+struct throwing_move {
+	int i;
+	throwing_move(int i) : i{i} {}
+	throwing_move(throwing_move&& that) noexcept(false) : i{that.i} {}
+	throwing_move& operator=(throwing_move&&) = default;
+};
+
+struct plain_int {
+	int i;
+	plain_int(int i) : i{i} {}
+};
+
+template <class T, class EP>
+void test_parallel(EP pol, int N)
+{
+	auto pred = [](int i) { return i % 3 == 1; };
+	std::vector<T> v;
+	std::vector<int> expected;
+	for (int i = 0; i < N; ++i) {
+		v.emplace_back((i * 7919) % N);
+		expected.push_back((i * 7919) % N);
+	}
+	auto pp = std::stable_partition(expected.begin(), expected.end(), pred);
+	auto r = ranges::stable_partition(pol, v, pred, &T::i);
+	CHECK((r - v.begin()) == (pp - expected.begin()));
+	for (int i = 0; i < N; ++i) {
+		CHECK(v[i].i == expected[i]);
+	}
+}
+
 int main()
 {
 	test_iter<forward_iterator<std::pair<int,int>*> >();
@@ -441,5 +475,16 @@ int main()
 		CHECK(std::is_partitioned(first, last, even));
 	}
 
+	// Parallel overloads
+	{
+		auto pol = ranges::ext::parallel_policy{4, 16};
+		test_parallel<plain_int>(pol, 5000);
+		test_parallel<plain_int>(pol, 63);
+		test_parallel<plain_int>(ranges::ext::seq, 1000);
+		test_parallel<throwing_move>(pol, 5000);
+		test_parallel<throwing_move>(ranges::ext::parallel_policy{7, 16}, 4999);
+		test_parallel<throwing_assign>(pol, 5000);
+	}
+
 	return ::test_result();
 }
@@ -234,5 +234,23 @@ int main()
 		}
 	}
 
+	// Check stability, with and without the temporary buffer
+	for (int n : {100, 1000})
+	{
+		std::vector<S> v(n, S{});
+		for(int i = 0; i < n; ++i)
+		{
+			v[i].i = (n - i) % 7;
+			v[i].j = i;
+		}
+		stl2::stable_sort(v, std::less<int>{}, &S::i);
+		for(int i = 1; i < n; ++i)
+		{
+			CHECK(v[i - 1].i <= v[i].i);
+			if (v[i - 1].i == v[i].i)
+				CHECK(v[i - 1].j < v[i].j);
+		}
+	}
+
 	return ::test_result();
 }
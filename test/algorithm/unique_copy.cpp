@@ -27,6 +27,9 @@
 
 #include <stl2/detail/algorithm/unique_copy.hpp>
 #include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -302,5 +305,19 @@ int main()
 		check_equal(stl2::ext::make_range(ib, ib+7), {S{1,1},S{2,2},S{3,3},S{4,5},S{5,6},S{6,9},S{7,10}});
 	}
 
+	// Test parallel overloads:
+	{
+		std::vector<int> v(1000), expected, out(1000);
+		for (int i = 0; i < 1000; ++i) {
+			v[i] = (i / 3) % 5;
+		}
+		std::unique_copy(v.begin(), v.end(), std::back_inserter(expected));
+
+		auto r = stl2::unique_copy(stl2::ext::parallel_policy{4, 16}, v, out.begin());
+		CHECK(r.in() == v.end());
+		CHECK((r.out() - out.begin()) == static_cast<std::ptrdiff_t>(expected.size()));
+		CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+	}
+
 	return ::test_result();
 }
@@ -0,0 +1,138 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/visit_each.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	using V = ranges::variant<int, void, double, char>;
+	using entry = std::pair<int, int>;
+
+	struct recorder {
+		std::vector<entry>* log;
+
+		void operator()(int& i) const { log->push_back({0, i}); }
+		void operator()(double& d) const { log->push_back({2, static_cast<int>(d)}); }
+		void operator()(char& c) const { log->push_back({3, c}); }
+	};
+
+	struct doubler {
+		int calls = 0;
+
+		void operator()(int& i) { ++calls; i *= 2; }
+		void operator()(double& d) { ++calls; d *= 2; }
+		void operator()(char&) { ++calls; }
+	};
+}
+
+int main() {
+	std::vector<V> const mixed = {
+		V{1}, V{2.0}, V{'a'}, V{3}, V{4.0}, V{5}, V{'b'}, V{'c'}
+	};
+
+	// Grouped by alternative, each group in order.
+	{
+		auto v = mixed;
+		std::vector<entry> log;
+		auto res = ranges::ext::visit_each(v, recorder{&log});
+		CHECK(res.in() == v.end());
+		CHECK(res.fun().log == &log);
+		std::vector<entry> const expected = {
+			{0, 1}, {0, 3}, {0, 5}, {2, 2}, {2, 4}, {3, 'a'}, {3, 'b'}, {3, 'c'}
+		};
+		CHECK(log == expected);
+	}
+
+	// In order.
+	{
+		auto v = mixed;
+		std::vector<entry> log;
+		auto res = ranges::ext::visit_each_in_order(v, recorder{&log});
+		CHECK(res.in() == v.end());
+		std::vector<entry> const expected = {
+			{0, 1}, {2, 2}, {3, 'a'}, {0, 3}, {2, 4}, {0, 5}, {3, 'b'}, {3, 'c'}
+		};
+		CHECK(log == expected);
+
+		// Single pass.
+		log.clear();
+		auto res2 = ranges::ext::visit_each_in_order(
+			input_iterator<V*>(v.data()),
+			sentinel<V*>(v.data() + v.size()),
+			recorder{&log});
+		CHECK(res2.in().base() == v.data() + v.size());
+		CHECK(log == expected);
+	}
+
+	// The visitor may modify the alternatives, and is returned.
+	{
+		auto v = mixed;
+		auto res = ranges::ext::visit_each(v, doubler{});
+		CHECK(res.fun().calls == 8);
+		CHECK(ranges::get<int>(v[0]) == 2);
+		CHECK(ranges::get<double>(v[1]) == 4.0);
+		CHECK(ranges::get<char>(v[2]) == 'a');
+		CHECK(ranges::get<int>(v[5]) == 10);
+
+		res = ranges::ext::visit_each_in_order(v, doubler{});
+		CHECK(res.fun().calls == 8);
+		CHECK(ranges::get<int>(v[0]) == 4);
+		CHECK(ranges::get<double>(v[4]) == 16.0);
+	}
+
+	// All one alternative, and nothing at all.
+	{
+		std::vector<V> v = {V{1}, V{2}, V{3}};
+		std::vector<entry> log;
+		ranges::ext::visit_each(v, recorder{&log});
+		CHECK(log == (std::vector<entry>{{0, 1}, {0, 2}, {0, 3}}));
+
+		log.clear();
+		std::vector<V> empty;
+		auto res = ranges::ext::visit_each(empty, recorder{&log});
+		CHECK(res.in() == empty.end());
+		res = ranges::ext::visit_each_in_order(empty, recorder{&log});
+		CHECK(res.in() == empty.end());
+		CHECK(log.empty());
+	}
+
+	// Both visit every element once, in blocks for visit_each.
+	{
+		std::vector<V> v;
+		for (int i = 0; i < 10000; ++i) {
+			switch ((i * 7919) % 3) {
+			case 0: v.push_back(V{i}); break;
+			case 1: v.push_back(V{static_cast<double>(i)}); break;
+			default: v.push_back(V{static_cast<char>(i % 128)}); break;
+			}
+		}
+		std::vector<entry> grouped, ordered;
+		ranges::ext::visit_each(v, recorder{&grouped});
+		ranges::ext::visit_each_in_order(v, recorder{&ordered});
+		CHECK(grouped.size() == v.size());
+		CHECK(ordered.size() == v.size());
+		// The elements that hold each alternative are visited in order.
+		auto by_alternative = [](const entry& a, const entry& b) {
+			return a.first < b.first;
+		};
+		std::stable_sort(grouped.begin(), grouped.end(), by_alternative);
+		std::stable_sort(ordered.begin(), ordered.end(), by_alternative);
+		CHECK(grouped == ordered);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,87 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/weighted_sample.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	ranges::ext::xoshiro256pp g{3};
+
+	// Without replacement
+	{
+		int data[] = {0, 1, 2, 3, 4, 5};
+		double weights[] = {1, 1, 1, 1, 0, 96};
+		int counts[6] = {};
+		int out[2];
+		for (int t = 0; t < 20000; ++t) {
+			auto result = ranges::ext::weighted_sample(input_iterator<int*>(data),
+				sentinel<int*>(data + 6), weights, out, 2, g);
+			CHECK(result.in().base() == data + 6);
+			CHECK(result.out() == out + 2);
+			CHECK(out[0] != out[1]);
+			++counts[out[0]];
+			++counts[out[1]];
+		}
+		// 5 is nearly always drawn, 4 never, and the others equally.
+		CHECK(counts[4] == 0);
+		CHECK(counts[5] > 19500);
+		for (int i = 0; i < 4; ++i) {
+			CHECK(counts[i] > 4500);
+			CHECK(counts[i] < 5500);
+		}
+	}
+	{
+		// First of two with weights 1 and 3: chosen with probability 1/4.
+		std::vector<int> data = {0, 1};
+		std::vector<int> weights = {1, 3};
+		int zeros = 0;
+		for (int t = 0; t < 40000; ++t) {
+			int out[1];
+			ranges::ext::weighted_sample(data, weights, out, 1, g);
+			zeros += out[0] == 0;
+		}
+		CHECK(zeros > 9500);
+		CHECK(zeros < 10500);
+	}
+	{
+		// Fewer positive weights than requested.
+		std::array<int, 4> data = {{1, 2, 3, 4}};
+		std::array<double, 4> weights = {{0, 2, 0, 1}};
+		std::array<int, 3> out{};
+		auto result = ranges::ext::weighted_sample(data, weights, out.begin(), 3, g);
+		CHECK(result.in() == data.end());
+		CHECK(result.out() == out.begin() + 2);
+		std::sort(out.begin(), out.begin() + 2);
+		CHECK(out[0] == 2);
+		CHECK(out[1] == 4);
+	}
+
+	// With replacement
+	{
+		std::vector<char> data = {'a', 'b', 'c'};
+		std::vector<double> weights = {2, 0, 6};
+		std::vector<char> out(80000);
+		CHECK(ranges::ext::weighted_sample_with_replacement(data, weights,
+			out.begin(), 80000, g) == out.end());
+		auto const a = std::count(out.begin(), out.end(), 'a');
+		CHECK(std::count(out.begin(), out.end(), 'b') == 0);
+		CHECK(a > 19000);
+		CHECK(a < 21000);
+		CHECK((a + std::count(out.begin(), out.end(), 'c')) == 80000);
+	}
+	return ::test_result();
+}
@@ -0,0 +1,244 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/container/flat_hash_map.hpp>
+#include <stl2/iterator.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+using ranges::ext::flat_hash_map;
+
+namespace {
+	// Not standard-layout: it has data members in both it and its base.
+	struct key_base {
+		int id;
+	};
+	struct layered_key : key_base {
+		std::string name;
+
+		layered_key(int i, std::string n) : key_base{i}, name(std::move(n)) {}
+
+		friend bool operator==(const layered_key& x, const layered_key& y) {
+			return x.id == y.id && x.name == y.name;
+		}
+		friend bool operator!=(const layered_key& x, const layered_key& y) {
+			return !(x == y);
+		}
+	};
+	struct layered_hash {
+		std::size_t operator()(const layered_key& k) const {
+			return std::hash<std::string>{}(k.name) ^ static_cast<std::size_t>(k.id);
+		}
+	};
+
+	// Also not standard-layout, so rehashing must copy it; the copy, and
+	// the hash, throw once their budgets run out.
+	struct fragile_key : key_base {
+		static int copies_left;
+		int tag = 0;
+
+		explicit fragile_key(int i) : key_base{i} {}
+		fragile_key(fragile_key&&) = default;
+		fragile_key(const fragile_key& that) : key_base{that}, tag{that.tag} {
+			if (copies_left >= 0 && copies_left-- == 0) {
+				throw std::runtime_error{"copy"};
+			}
+		}
+		fragile_key& operator=(fragile_key&&) = default;
+		fragile_key& operator=(const fragile_key&) = default;
+
+		friend bool operator==(const fragile_key& x, const fragile_key& y) {
+			return x.id == y.id;
+		}
+		friend bool operator!=(const fragile_key& x, const fragile_key& y) {
+			return !(x == y);
+		}
+	};
+	int fragile_key::copies_left = -1;
+
+	struct fragile_hash {
+		static int calls_left;
+		std::size_t operator()(const fragile_key& k) const {
+			return (*this)(k.id);
+		}
+		std::size_t operator()(int i) const {
+			if (calls_left >= 0 && calls_left-- == 0) {
+				throw std::runtime_error{"hash"};
+			}
+			return static_cast<std::size_t>(i);
+		}
+	};
+	int fragile_hash::calls_left = -1;
+
+	// Inserts keys 0, 1, ... into m, arming fail before each insertion,
+	// until an insertion throws; then checks that m still holds exactly
+	// the keys inserted before it, and that it can still grow.
+	template <class M, class Arm>
+	void check_rehash_rollback(M& m, Arm arm) {
+		int n = 0;
+		bool threw = false;
+		for (; n < 10000 && !threw; ++n) {
+			arm(true);
+			try {
+				m.try_emplace(typename M::key_type{n}, -n);
+			} catch(std::runtime_error&) {
+				threw = true;
+			}
+			arm(false);
+		}
+		CHECK(threw);
+		n -= 1;
+		CHECK(m.size() == static_cast<std::size_t>(n));
+		bool intact = true;
+		for (int i = 0; i < n; ++i) {
+			auto const p = m.find(typename M::key_type{i});
+			intact = intact && p != m.end() && p->second == -i;
+		}
+		CHECK(intact);
+		for (int i = n; i < 2 * n; ++i) {
+			m.try_emplace(typename M::key_type{i}, -i);
+		}
+		CHECK(m.size() == static_cast<std::size_t>(2 * n));
+	}
+}
+
+int main() {
+	using M = flat_hash_map<std::string, int>;
+	static_assert(ranges::models::ForwardRange<M>);
+	static_assert(ranges::models::ForwardRange<const M>);
+	static_assert(ranges::models::SizedRange<M>);
+	static_assert(ranges::models::ConvertibleTo<M::iterator, M::const_iterator>);
+	static_assert(ranges::models::Same<
+		ranges::reference_t<M::iterator>, std::pair<const std::string, int>&>);
+
+	{
+		M m{{"one", 1}, {"two", 2}, {"one", 3}};
+		CHECK(m.size() == 2u);
+		CHECK(m.at("one") == 1);
+		CHECK(m["two"] == 2);
+		CHECK(m["three"] == 0);
+		CHECK(m.size() == 3u);
+		m["three"] = 3;
+		CHECK(m.find("three")->second == 3);
+		CHECK(!m.try_emplace("three", 33).second);
+		CHECK(m.at("three") == 3);
+		CHECK(!m.insert_or_assign("three", 33).second);
+		CHECK(m.at("three") == 33);
+		CHECK(m.emplace("four", 4).second);
+		CHECK(!m.insert({"four", 44}).second);
+		CHECK(m.at("four") == 4);
+		try {
+			m.at("five");
+			CHECK(false);
+		} catch(std::out_of_range&) {}
+
+		int sum = 0;
+		for (auto&& e : m) {
+			sum += e.second;
+		}
+		CHECK(sum == 1 + 2 + 33 + 4);
+		for (auto&& e : m) {
+			++e.second;
+		}
+		CHECK(m.at("one") == 2);
+
+		const M& cm = m;
+		CHECK(cm.find("two")->second == 3);
+		M::const_iterator ci = m.begin();
+		CHECK(ci == cm.begin());
+
+		CHECK(m.erase("one") == 1u);
+		m.erase(m.find("two"));
+		CHECK(!m.contains("two"));
+		CHECK(m.size() == 2u);
+		M n{{"three", 34}, {"four", 5}};
+		CHECK(m == n);
+		n["four"] = 6;
+		CHECK(m != n);
+	}
+
+	{
+		// Move-only mapped values, relocated through rehashes.
+		flat_hash_map<int, std::unique_ptr<int>> m;
+		std::unordered_map<int, int> ref;
+		unsigned x = 777;
+		for (int i = 0; i < 20000; ++i) {
+			x = x * 1103515245u + 12345u;
+			int const k = static_cast<int>((x >> 8) % 3000);
+			if (x & 0x10000) {
+				bool const inserted = m.try_emplace(k, std::make_unique<int>(i)).second;
+				CHECK(inserted == ref.emplace(k, i).second);
+			} else {
+				CHECK(m.erase(k) == ref.erase(k));
+			}
+		}
+		CHECK(m.size() == ref.size());
+		bool matched = true;
+		for (auto&& e : m) {
+			matched = matched && ref.at(e.first) == *e.second;
+		}
+		CHECK(matched);
+	}
+
+	{
+		// String keys are moved, not copied, when the table grows.
+		flat_hash_map<std::string, std::vector<int>> m;
+		for (int i = 0; i < 1000; ++i) {
+			m[std::string(40, 'k') + std::to_string(i)].push_back(i);
+		}
+		CHECK(m.size() == 1000u);
+		CHECK(m.at(std::string(40, 'k') + "999").front() == 999);
+		auto copy = m;
+		CHECK(copy == m);
+		m.reserve(5000);
+		CHECK(m.bucket_count() >= 5000u);
+		CHECK(copy == m);
+	}
+
+	{
+		// Entries whose pair types may not be punned are moved as
+		// pair<const Key, T> when the table grows.
+		static_assert(ranges::detail::hash_map_slot_punnable<int, std::unique_ptr<int>>);
+		static_assert(!ranges::detail::hash_map_slot_punnable<layered_key, std::string>);
+		flat_hash_map<layered_key, std::string, layered_hash> m;
+		for (int i = 0; i < 1000; ++i) {
+			m.try_emplace(layered_key{i, std::to_string(i)}, std::string(30, 'v') + std::to_string(i));
+		}
+		CHECK(m.size() == 1000u);
+		bool matched = true;
+		for (auto&& e : m) {
+			matched = matched && e.first.name == std::to_string(e.first.id) &&
+				e.second == std::string(30, 'v') + e.first.name;
+		}
+		CHECK(matched);
+		CHECK(m.at(layered_key{999, "999"}) == std::string(30, 'v') + "999");
+	}
+
+	{
+		// A rehash that throws leaves the table as it was: a key copy that
+		// throws partway through, or a hash that throws before any entry
+		// has been relocated.
+		static_assert(!ranges::detail::hash_map_slot_punnable<fragile_key, int>);
+		flat_hash_map<fragile_key, int, fragile_hash> m;
+		check_rehash_rollback(m, [](bool on) { fragile_key::copies_left = on ? 3 : -1; });
+
+		static_assert(ranges::detail::hash_map_slot_punnable<int, int>);
+		flat_hash_map<int, int, fragile_hash> m2;
+		check_rehash_rollback(m2, [](bool on) { fragile_hash::calls_left = on ? 1 : -1; });
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,173 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/container/flat_hash_set.hpp>
+#include <stl2/iterator.hpp>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+using ranges::ext::flat_hash_set;
+
+namespace {
+	struct string_hash {
+		using is_transparent = void;
+		std::size_t operator()(const std::string& s) const {
+			return std::hash<std::string>{}(s);
+		}
+		std::size_t operator()(const char* s) const {
+			return std::hash<std::string>{}(s);
+		}
+	};
+
+	struct string_equal {
+		using is_transparent = void;
+		bool operator()(const std::string& x, const std::string& y) const {
+			return x == y;
+		}
+		bool operator()(const std::string& x, const char* y) const {
+			return x == y;
+		}
+	};
+
+	// Every key lands on the same probe sequence.
+	struct bad_hash {
+		std::size_t operator()(int) const { return 42; }
+	};
+}
+
+int main() {
+	using S = flat_hash_set<int>;
+	static_assert(ranges::models::ForwardRange<S>);
+	static_assert(ranges::models::SizedRange<S>);
+	static_assert(ranges::models::Same<ranges::reference_t<S::iterator>, const int&>);
+
+	{
+		S s;
+		CHECK(s.empty());
+		CHECK(s.begin() == s.end());
+		CHECK(s.find(1) == s.end());
+		CHECK(!s.contains(1));
+		CHECK(s.erase(1) == 0u);
+		CHECK(s.bucket_count() == 0u);
+
+		CHECK(s.insert(1).second);
+		CHECK(!s.insert(1).second);
+		CHECK(*s.emplace(2).first == 2);
+		CHECK(s.size() == 2u);
+		CHECK(s.contains(1));
+		CHECK(s.count(2) == 1u);
+		CHECK(s.count(3) == 0u);
+		CHECK(s.erase(1) == 1u);
+		CHECK(!s.contains(1));
+		CHECK(s.size() == 1u);
+	}
+
+	{
+		// Inserts and erases against std::unordered_set, through growth and
+		// rehashes that clear deleted slots.
+		S s;
+		std::unordered_set<int> ref;
+		unsigned x = 12345;
+		for (int i = 0; i < 20000; ++i) {
+			x = x * 1103515245u + 12345u;
+			int const k = static_cast<int>((x >> 8) % 2000);
+			if (x & 0x10000) {
+				CHECK(s.insert(k).second == ref.insert(k).second);
+			} else {
+				CHECK(s.erase(k) == ref.erase(k));
+			}
+		}
+		CHECK(s.size() == ref.size());
+		CHECK(static_cast<std::size_t>(ranges::distance(s)) == ref.size());
+		for (auto k : s) {
+			CHECK(ref.count(k) == 1u);
+		}
+		CHECK(s.load_factor() <= s.max_load_factor());
+	}
+
+	{
+		S s{1, 2, 3, 2, 1};
+		CHECK(s.size() == 3u);
+		s.reserve(1000);
+		auto const buckets = s.bucket_count();
+		CHECK(buckets >= 1000u);
+		for (int i = 0; i < 1000; ++i) {
+			s.insert(i);
+		}
+		CHECK(s.bucket_count() == buckets);
+		CHECK(s.size() == 1000u);
+
+		// Erasing while iterating visits every element once.
+		for (auto i = s.begin(); i != s.end();) {
+			i = *i % 2 ? s.erase(i) : ranges::next(i);
+		}
+		CHECK(s.size() == 500u);
+		for (int i = 0; i < 1000; ++i) {
+			CHECK(s.contains(i) == (i % 2 == 0));
+		}
+
+		s.rehash(0);
+		CHECK(s.bucket_count() < buckets);
+		CHECK(s.size() == 500u);
+		CHECK(s.contains(998));
+
+		S t = s;
+		CHECK(t == s);
+		t.erase(0);
+		CHECK(t != s);
+		S u = std::move(t);
+		CHECK(u.size() == 499u);
+		ranges::swap(u, s);
+		CHECK(s.size() == 499u);
+		CHECK(u.size() == 500u);
+		u.clear();
+		CHECK(u.empty());
+		CHECK(u.begin() == u.end());
+		u.insert(7);
+		CHECK(u.contains(7));
+		u.rehash(0);
+		u.erase(7);
+		u.rehash(0);
+		CHECK(u.bucket_count() == 0u);
+	}
+
+	{
+		flat_hash_set<std::string, string_hash, string_equal> s{"a", "b"};
+		CHECK(s.contains("a"));
+		CHECK(s.find("b") != s.end());
+		CHECK(!s.contains("c"));
+		CHECK(s.erase("a") == 1u);
+		CHECK(s.size() == 1u);
+
+		// Without a transparent hash, lookups convert to the key type.
+		flat_hash_set<std::string> t{"a"};
+		CHECK(t.contains("a"));
+	}
+
+	{
+		flat_hash_set<int, bad_hash> s;
+		for (int i = 0; i < 100; ++i) {
+			s.insert(i);
+		}
+		for (int i = 0; i < 100; i += 2) {
+			s.erase(i);
+		}
+		CHECK(s.size() == 50u);
+		for (int i = 0; i < 100; ++i) {
+			CHECK(s.contains(i) == (i % 2 == 1));
+		}
+	}
+
+	return ::test_result();
+}
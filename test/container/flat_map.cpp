@@ -0,0 +1,131 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/container/flat_map.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/algorithm/is_sorted.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+using ranges::ext::flat_map;
+
+int main() {
+	using M = flat_map<int, std::string>;
+	static_assert(ranges::models::RandomAccessRange<M>);
+	static_assert(ranges::models::RandomAccessRange<const M>);
+	static_assert(ranges::models::SizedRange<M>);
+	static_assert(ranges::models::ConvertibleTo<M::iterator, M::const_iterator>);
+	static_assert(ranges::models::Same<
+		ranges::reference_t<M::iterator>, std::pair<const int&, std::string&>>);
+	static_assert(ranges::models::Same<
+		ranges::value_type_t<M::iterator>, std::pair<int, std::string>>);
+
+	{
+		M m{{3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}};
+		CHECK(m.size() == 3u);
+		::check_equal(m.keys(), {1, 2, 3});
+		::check_equal(m.values(), {"a", "b", "c"});
+		CHECK(m.at(3) == "c");
+		CHECK(m.contains(2));
+		CHECK(!m.contains(4));
+		CHECK(m.find(4) == m.end());
+		CHECK((*m.find(2)).second == "b");
+		CHECK((*m.lower_bound(2)).first == 2);
+		CHECK((*m.upper_bound(2)).first == 3);
+		try {
+			m.at(4);
+			CHECK(false);
+		} catch(std::out_of_range&) {}
+
+		m[4] = "d";
+		m[1] += "a";
+		CHECK(m.at(1) == "aa");
+		CHECK(m.size() == 4u);
+		CHECK(!m.try_emplace(4, "z").second);
+		CHECK(m.at(4) == "d");
+		CHECK(!m.insert_or_assign(4, "z").second);
+		CHECK(m.at(4) == "z");
+		CHECK(m.insert({0, "o"}).second);
+		CHECK(!m.emplace(0, "p").second);
+		CHECK(m.at(0) == "o");
+
+		CHECK(m.erase(2) == 1u);
+		CHECK(m.erase(2) == 0u);
+		auto i = m.erase(m.cbegin());
+		CHECK((*i).first == 1);
+		::check_equal(m.keys(), {1, 3, 4});
+		::check_equal(m.values(), {"aa", "c", "z"});
+
+		const M& cm = m;
+		auto ci = cm.find(3);
+		CHECK((*ci).second == "c");
+		M::const_iterator j = m.begin();
+		CHECK(j == cm.begin());
+		CHECK((cm.end() - j) == 3);
+	}
+
+	{
+		// Batch insert keeps existing entries over inserted duplicates
+		// and the first of several inserted duplicates.
+		M m{{10, "ten"}, {20, "twenty"}};
+		std::vector<std::pair<int, std::string>> v = {
+			{15, "a"}, {20, "b"}, {5, "c"}, {15, "d"}, {30, "e"}};
+		m.insert(v.begin(), v.end());
+		::check_equal(m.keys(), {5, 10, 15, 20, 30});
+		::check_equal(m.values(), {"c", "ten", "a", "twenty", "e"});
+		for (auto&& p : m) {
+			p.second += "!";
+		}
+		CHECK(m.at(15) == "a!");
+	}
+
+	{
+		// Large batches sort and merge through the zip of keys and values.
+		flat_map<int, std::string> m;
+		std::vector<int> keys;
+		std::vector<std::string> values;
+		for (int i = 0; i < 1000; ++i) {
+			keys.push_back((i * 7919) % 1009);
+			values.push_back(std::to_string(keys.back()));
+		}
+		m = flat_map<int, std::string>{keys, values};
+		CHECK(m.size() == 1000u);
+		CHECK(ranges::is_sorted(m.keys()));
+		std::vector<std::pair<int, std::string>> more;
+		for (int i = 0; i < 1009; ++i) {
+			more.emplace_back(i, "new");
+		}
+		m.insert(more.begin(), more.end());
+		CHECK(m.size() == 1009u);
+		bool matched = true;
+		for (auto&& p : m) {
+			matched = matched && (p.second == "new" || p.second == std::to_string(p.first));
+		}
+		CHECK(matched);
+		CHECK(m.at(1) != "new");
+	}
+
+	{
+		M m{ranges::ext::sorted_unique, {1, 2}, {"a", "b"}};
+		M n{{2, "b"}, {1, "a"}};
+		CHECK(m == n);
+		n[3];
+		CHECK(m != n);
+		ranges::swap(m, n);
+		CHECK(m.size() == 3u);
+		CHECK(m.at(3).empty());
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,168 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/container/flat_set.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/algorithm/is_sorted.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+using ranges::ext::flat_set;
+
+namespace {
+	struct keyed {
+		int key;
+		int tag;
+	};
+	struct by_key {
+		bool operator()(const keyed& x, const keyed& y) const { return x.key < y.key; }
+	};
+
+	// Converts to int, but throws for negative values.
+	struct checked_int {
+		int value;
+		operator int() const {
+			if (value < 0) {
+				throw std::runtime_error{"negative"};
+			}
+			return value;
+		}
+	};
+}
+
+int main() {
+	using S = flat_set<int>;
+	static_assert(ranges::models::RandomAccessRange<S>);
+	static_assert(ranges::models::SizedRange<S>);
+
+	{
+		S s{5, 3, 5, 1, 3, 9};
+		::check_equal(s, {1, 3, 5, 9});
+		CHECK(s.size() == 4u);
+		CHECK(s.contains(3));
+		CHECK(!s.contains(4));
+		CHECK(s.count(9) == 1u);
+		CHECK(s.find(4) == s.end());
+		CHECK(*s.find(5) == 5);
+		CHECK(*s.lower_bound(4) == 5);
+		CHECK(*s.upper_bound(5) == 9);
+		CHECK(s.upper_bound(9) == s.end());
+		auto r = s.equal_range(3);
+		CHECK((r.begin() + 1) == r.end());
+		CHECK(*r.begin() == 3);
+		r = s.equal_range(4);
+		CHECK(r.begin() == r.end());
+
+		CHECK(s.insert(4).second);
+		CHECK(!s.insert(4).second);
+		CHECK(*s.emplace(0).first == 0);
+		::check_equal(s, {0, 1, 3, 4, 5, 9});
+		CHECK(s.erase(3) == 1u);
+		CHECK(s.erase(3) == 0u);
+		s.erase(s.begin());
+		::check_equal(s, {1, 4, 5, 9});
+	}
+
+	{
+		// Batch insert merges new keys into the existing ones.
+		S s{10, 20, 30};
+		std::vector<int> v = {25, 5, 20, 35, 5, 15};
+		s.insert(v.begin(), v.end());
+		::check_equal(s, {5, 10, 15, 20, 25, 30, 35});
+		s.insert({1, 2});
+		::check_equal(s, {1, 2, 5, 10, 15, 20, 25, 30, 35});
+		s.insert(ranges::ext::sorted_unique, v.begin(), v.begin());
+		CHECK(s.size() == 9u);
+		int more[] = {3, 4, 40};
+		s.insert(ranges::ext::sorted_unique, ranges::begin(more), ranges::end(more));
+		::check_equal(s, {1, 2, 3, 4, 5, 10, 15, 20, 25, 30, 35, 40});
+	}
+
+	{
+		// Large batches against a large set.
+		S s;
+		std::vector<int> v;
+		for (int i = 0; i < 1000; ++i) {
+			v.push_back((i * 7919) % 1009);
+		}
+		s.insert(v.begin(), v.end());
+		s.insert(v.begin(), v.end());
+		CHECK(s.size() == 1000u);
+		CHECK(ranges::is_sorted(s));
+		for (int i = 0; i < 1009; ++i) {
+			CHECK(s.contains(i) == (s.find(i) != s.end()));
+		}
+	}
+
+	{
+		S s{std::vector<int>{3, 1, 2, 1}};
+		::check_equal(s, {1, 2, 3});
+		S t{ranges::ext::sorted_unique, std::vector<int>{1, 2, 3}};
+		CHECK(s == t);
+		t.insert(0);
+		CHECK(t < s);
+		CHECK(s != t);
+		ranges::swap(s, t);
+		CHECK(s.size() == 4u);
+		auto keys = s.extract();
+		CHECK(s.empty());
+		CHECK(keys.size() == 4u);
+	}
+
+	{
+		// The first of several equivalent keys is kept.
+		flat_set<keyed, by_key> s{{2, 0}, {1, 1}, {2, 2}, {1, 3}};
+		CHECK(s.size() == 2u);
+		CHECK(s.find(keyed{1, -1})->tag == 1);
+		CHECK(s.find(keyed{2, -1})->tag == 0);
+		std::vector<keyed> v = {{2, 4}, {3, 5}, {3, 6}};
+		s.insert(v.begin(), v.end());
+		CHECK(s.size() == 3u);
+		CHECK(s.find(keyed{2, -1})->tag == 0);
+		CHECK(s.find(keyed{3, -1})->tag == 5);
+	}
+
+	{
+		flat_set<std::string, ranges::greater<>> s{"b", "a", "c", "a"};
+		::check_equal(s, {"c", "b", "a"});
+		CHECK(s.contains(std::string{"b"}));
+		CHECK(!s.contains(std::string{"d"}));
+	}
+
+	{
+		// An insertion that throws partway through leaves the set as it was.
+		S s{4, 8};
+		std::vector<checked_int> in = {{9}, {1}, {-1}, {2}};
+		bool threw = false;
+		try {
+			s.insert(in.begin(), in.end());
+		} catch(std::runtime_error&) {
+			threw = true;
+		}
+		CHECK(threw);
+		::check_equal(s, {4, 8});
+		threw = false;
+		try {
+			s.insert(ranges::ext::sorted_unique, in.begin() + 1, in.end());
+		} catch(std::runtime_error&) {
+			threw = true;
+		}
+		CHECK(threw);
+		::check_equal(s, {4, 8});
+		s.insert(in.begin(), in.begin() + 2);
+		::check_equal(s, {1, 4, 8, 9});
+	}
+
+	return ::test_result();
+}
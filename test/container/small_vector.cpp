@@ -0,0 +1,218 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/container/small_vector.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/is_sorted.hpp>
+#include <memory>
+#include <string>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+using ranges::ext::small_vector;
+
+namespace {
+	struct counted {
+		static int live;
+		static int throw_after;
+		int value;
+
+		counted(int i) : value{i} {
+			if (throw_after >= 0 && throw_after-- == 0) {
+				throw 42;
+			}
+			++live;
+		}
+		counted(const counted& that) : counted(that.value) {}
+		counted& operator=(const counted&) = default;
+		~counted() { --live; }
+	};
+	int counted::live = 0;
+	int counted::throw_after = -1;
+
+	struct handle {
+		std::unique_ptr<int> p;
+		handle(int i) : p{new int{i}} {}
+	};
+}
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template <>
+		struct is_trivially_relocatable<handle> : true_type {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+namespace {
+	void test_concepts() {
+		using V = small_vector<int, 8>;
+		static_assert(ranges::models::RandomAccessRange<V>);
+		static_assert(ranges::models::SizedRange<V>);
+		static_assert(ranges::models::BoundedRange<V>);
+		static_assert(ranges::models::ContiguousIterator<ranges::iterator_t<V>>);
+		static_assert(ranges::models::RandomAccessRange<const V>);
+		static_assert(ranges::models::Regular<V>);
+		static_assert(ranges::models::StrictTotallyOrdered<V>);
+		static_assert(!ranges::models::Copyable<small_vector<std::unique_ptr<int>, 2>>);
+		static_assert(ranges::models::Movable<small_vector<std::unique_ptr<int>, 2>>);
+	}
+
+	void test_basic() {
+		small_vector<int, 4> v;
+		CHECK(v.empty());
+		CHECK(v.capacity() == 4u);
+		CHECK(v.is_inline());
+		for (int i = 0; i < 4; ++i) {
+			v.push_back(i);
+		}
+		CHECK(v.is_inline());
+		v.push_back(4);
+		CHECK(!v.is_inline());
+		CHECK(v.size() == 5u);
+		CHECK(v.capacity() >= 8u);
+		::check_equal(v, {0, 1, 2, 3, 4});
+
+		v.push_back(v[0]);
+		CHECK(v.back() == 0);
+		v.pop_back();
+
+		v.insert(v.begin() + 1, 10);
+		::check_equal(v, {0, 10, 1, 2, 3, 4});
+		v.insert(v.end() - 1, 2, 7);
+		::check_equal(v, {0, 10, 1, 2, 3, 7, 7, 4});
+		int more[] = {20, 21};
+		auto i = v.insert(v.begin(), ranges::begin(more), ranges::end(more));
+		CHECK(i == v.begin());
+		::check_equal(v, {20, 21, 0, 10, 1, 2, 3, 7, 7, 4});
+		v.erase(v.begin(), v.begin() + 3);
+		v.erase(v.begin());
+		::check_equal(v, {1, 2, 3, 7, 7, 4});
+		v.emplace(v.begin(), v.back());
+		::check_equal(v, {4, 1, 2, 3, 7, 7, 4});
+
+		v.resize(2);
+		::check_equal(v, {4, 1});
+		v.shrink_to_fit();
+		CHECK(v.is_inline());
+		::check_equal(v, {4, 1});
+		v.resize(5, 9);
+		::check_equal(v, {4, 1, 9, 9, 9});
+		v.resize(6);
+		CHECK(v.back() == 0);
+
+		v = {3, 2, 1};
+		::check_equal(v, {3, 2, 1});
+		v.assign(6, 5);
+		::check_equal(v, {5, 5, 5, 5, 5, 5});
+		CHECK(v.at(5) == 5);
+		bool thrown = false;
+		try {
+			v.at(6);
+		} catch(std::out_of_range&) {
+			thrown = true;
+		}
+		CHECK(thrown);
+	}
+
+	void test_copy_move() {
+		small_vector<std::string, 2> a = {"a", "b"};
+		auto b = a;
+		CHECK(a == b);
+		b.push_back("c");
+		CHECK(a != b);
+		CHECK(a < b);
+
+		auto c = std::move(b);
+		CHECK(c.size() == 3u);
+		CHECK(b.empty());
+		CHECK(b.is_inline());
+
+		auto d = std::move(a);
+		CHECK(d.is_inline());
+		CHECK(d[1] == "b");
+
+		swap(c, d);
+		CHECK(c.size() == 2u);
+		CHECK(d.size() == 3u);
+		CHECK(d[2] == "c");
+
+		c = d;
+		CHECK(c == d);
+		d = small_vector<std::string, 2>{};
+		CHECK(d.empty());
+	}
+
+	void test_relocation() {
+		small_vector<handle, 2> v;
+		for (int i = 0; i < 100; ++i) {
+			v.emplace_back(i);
+		}
+		CHECK(*v[99].p == 99);
+		auto w = std::move(v);
+		CHECK(*w[0].p == 0);
+		w.erase(w.begin() + 2, w.end());
+		w.shrink_to_fit();
+		CHECK(w.is_inline());
+		CHECK(*w[1].p == 1);
+
+		small_vector<std::unique_ptr<int>, 1> u;
+		u.push_back(std::make_unique<int>(1));
+		u.push_back(std::make_unique<int>(2));
+		CHECK(*u[1] == 2);
+	}
+
+	void test_exceptions() {
+		{
+			small_vector<counted, 4> v;
+			for (int i = 0; i < 4; ++i) {
+				v.emplace_back(i);
+			}
+			// The growth copies (counted's move may throw) and fails
+			// part-way; v is left as it was.
+			counted::throw_after = 2;
+			bool caught = false;
+			try {
+				v.emplace_back(4);
+			} catch(int) {
+				caught = true;
+			}
+			counted::throw_after = -1;
+			CHECK(caught);
+			CHECK(v.size() == 4u);
+			CHECK(v.is_inline());
+			CHECK(v[3].value == 3);
+			CHECK(counted::live == 4);
+		}
+		CHECK(counted::live == 0);
+	}
+
+	void test_algorithms() {
+		small_vector<int, 16> v;
+		int src[] = {5, 3, 9, 1, 7, 2, 8};
+		ranges::copy(src, ranges::back_inserter(v));
+		CHECK(v.size() == 7u);
+		ranges::sort(v);
+		CHECK(ranges::is_sorted(v));
+		::check_equal(v, {1, 2, 3, 5, 7, 8, 9});
+	}
+}
+
+int main() {
+	test_concepts();
+	test_basic();
+	test_copy_move();
+	test_relocation();
+	test_exceptions();
+	test_algorithms();
+	return ::test_result();
+}
@@ -0,0 +1,86 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/random.hpp>
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	// Draws from table and checks that index i comes up with probability
+	// weights[i] / sum, to within five standard deviations.
+	template <class Gen>
+	void check_frequencies(const ranges::ext::alias_table& table,
+		const std::vector<double>& weights, Gen& g)
+	{
+		constexpr int draws = 400000;
+		double sum = 0;
+		for (auto w : weights) {
+			sum += w;
+		}
+		std::vector<int> counts(weights.size());
+		for (int i = 0; i < draws; ++i) {
+			auto const x = table(g);
+			CHECK(x < weights.size());
+			++counts[x];
+		}
+		for (std::size_t i = 0; i < weights.size(); ++i) {
+			auto const expected = draws * weights[i] / sum;
+			if (weights[i] == 0) {
+				CHECK(counts[i] == 0);
+			} else {
+				auto const tolerance = 5 * std::sqrt(expected);
+				CHECK(counts[i] > expected - tolerance);
+				CHECK(counts[i] < expected + tolerance);
+			}
+		}
+	}
+}
+
+int main() {
+	ranges::ext::xoshiro256pp g{1};
+	{
+		std::vector<double> w = {1, 2, 3, 4, 0, 10};
+		ranges::ext::alias_table table{w};
+		CHECK(table.size() == 6u);
+		CHECK(table.min() == 0u);
+		CHECK(table.max() == 5u);
+		check_frequencies(table, w, g);
+	}
+	{
+		// Integer weights, from a non-random-access range.
+		std::list<int> l = {5, 1, 1, 1};
+		ranges::ext::alias_table table{l};
+		check_frequencies(table, {5, 1, 1, 1}, g);
+	}
+	{
+		ranges::ext::alias_table table = {0.5};
+		for (int i = 0; i < 100; ++i) {
+			CHECK(table(g) == 0u);
+		}
+	}
+	{
+		// Any generator will do.
+		std::minstd_rand m;
+		std::vector<double> w(100);
+		for (std::size_t i = 0; i < w.size(); ++i) {
+			w[i] = static_cast<double>(i % 7) + 1;
+		}
+		ranges::ext::alias_table table{w};
+		check_frequencies(table, w, m);
+	}
+	return ::test_result();
+}
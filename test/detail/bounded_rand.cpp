@@ -0,0 +1,88 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/bounded_rand.hpp>
+#include <stl2/detail/random_engine.hpp>
+#include <cstdint>
+#include <random>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	// Draws enough values in [0, 10) that every count should land well
+	// within 10% of the mean.
+	template <class Gen>
+	void test_uniform(Gen g) {
+		constexpr int draws = 100000;
+		int counts[10] = {};
+		for (int i = 0; i < draws; ++i) {
+			auto const x = ranges::ext::bounded_rand(g, 10);
+			CHECK(x < 10u);
+			++counts[x];
+		}
+		for (auto c : counts) {
+			CHECK(c > draws / 10 * 9 / 10);
+			CHECK(c < draws / 10 * 11 / 10);
+		}
+	}
+
+	template <class Gen>
+	void test_batch(Gen g) {
+		std::uint64_t const bounds[6] = {2, 3, 5, 7, 1000, 1};
+		std::uint64_t out[6];
+		int counts[3] = {};
+		for (int i = 0; i < 30000; ++i) {
+			ranges::ext::bounded_rand_batch(g, bounds, out);
+			for (int k = 0; k < 6; ++k) {
+				CHECK(out[k] < bounds[k]);
+			}
+			++counts[out[1]];
+		}
+		for (auto c : counts) {
+			CHECK(c > 9000);
+			CHECK(c < 11000);
+		}
+	}
+
+	void test_edges() {
+		ranges::ext::xoshiro256pp g{42};
+		CHECK(ranges::ext::bounded_rand(g, 1) == 0u);
+		auto const big = ~std::uint64_t{0};
+		for (int i = 0; i < 100; ++i) {
+			CHECK(ranges::ext::bounded_rand(g, big) < big);
+		}
+	}
+
+	void test_batch_size() {
+		using ranges::detail::batch_size;
+		CHECK(batch_size(2) == 6u);
+		CHECK(batch_size(2000) == 4u);
+		CHECK(batch_size(100000) == 3u);
+		CHECK(batch_size(std::uint64_t{1} << 30) == 2u);
+		CHECK(batch_size(std::uint64_t{1} << 40) == 1u);
+	}
+}
+
+int main() {
+	// Full-width 64- and 32-bit engines take the multiply-shift path...
+	test_uniform(ranges::ext::xoshiro256pp{1});
+	test_uniform(std::mt19937{2});
+	test_batch(ranges::ext::splitmix64{3});
+	test_batch(std::mt19937{4});
+	// ...anything else goes through uniform_int_distribution.
+	CHECK(!ranges::detail::full_width_urng<std::minstd_rand>);
+	test_uniform(std::minstd_rand{5});
+	test_batch(std::minstd_rand{6});
+	test_edges();
+	test_batch_size();
+	return ::test_result();
+}
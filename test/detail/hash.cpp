@@ -0,0 +1,173 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/hash_value.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <set>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../hash_test_types.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	namespace custom {
+		struct point {
+			int x, y;
+			double weight;
+		};
+
+		std::size_t hash_value(const point& p) {
+			return static_cast<std::size_t>(p.x * 31 + p.y);
+		}
+	}
+
+	enum class color { red, green, blue };
+
+	struct opaque {
+		char c;
+		double d;
+	};
+
+	void test_bytes() {
+		using ranges::ext::hash_bytes;
+		unsigned char buf[256];
+		for (int i = 0; i < 256; ++i) {
+			buf[i] = static_cast<unsigned char>(i * 37);
+		}
+		// Deterministic, seed-sensitive, and sensitive to every length and
+		// every byte across the short, medium and bulk paths.
+		std::set<std::size_t> seen;
+		for (std::size_t n = 0; n <= 200; ++n) {
+			auto const h = hash_bytes(buf, n);
+			CHECK(h == hash_bytes(buf, n));
+			seen.insert(h);
+		}
+		CHECK(seen.size() == 201u);
+		CHECK(hash_bytes(buf, 64, 1) != hash_bytes(buf, 64, 2));
+		for (std::size_t i : {0u, 3u, 7u, 15u, 16u, 31u, 47u, 48u, 63u, 99u}) {
+			auto const before = hash_bytes(buf, 100);
+			buf[i] ^= 1;
+			CHECK(hash_bytes(buf, 100) != before);
+			buf[i] ^= 1;
+		}
+	}
+
+	void test_trivially_hashable() {
+		using ranges::ext::is_trivially_hashable_v;
+		CHECK(is_trivially_hashable_v<int>);
+		CHECK(is_trivially_hashable_v<color>);
+		CHECK(is_trivially_hashable_v<int*>);
+		CHECK(!is_trivially_hashable_v<std::string>);
+		CHECK(!is_trivially_hashable_v<double>);
+		CHECK(!is_trivially_hashable_v<Id>);
+		CHECK(!is_trivially_hashable_v<custom::point>);
+	}
+
+	void test_hash_value() {
+		using ranges::ext::hash_value;
+		CHECK(hash_value(42) == hash_value(42));
+		CHECK(hash_value(42) != hash_value(43));
+		CHECK(hash_value(color::red) != hash_value(color::green));
+		// Floating-point goes through std::hash, so that 0.0 == -0.0 hash
+		// equally.
+		CHECK(hash_value(0.0) == hash_value(-0.0));
+
+		std::string s = "The quick brown fox";
+		std::vector<char> v(s.begin(), s.end());
+		CHECK(hash_value(s) == hash_value(v));
+		CHECK(hash_value(s) != hash_value(std::string{"The quick brown fix"}));
+
+		CHECK(hash_value(custom::point{1, 2, 0.5}) == 33u);
+
+		// Class types hash by std::hash, not by their bytes.
+		CHECK(hash_value(Id{7, 0}) == hash_value(Id{7, 1}));
+		CHECK(hash_value(Id{7, 0}) != hash_value(Id{8, 0}));
+		std::vector<Id> ids = {{1, 0}, {2, 0}};
+		std::vector<Id> ids2 = {{1, 5}, {2, 9}};
+		CHECK(hash_value(ids) == hash_value(ids2));
+		CHECK(ranges::ext::hash_range(ids) == ranges::ext::hash_range(ids2));
+
+		std::list<int> l = {1, 2, 3};
+		std::list<int> l2 = {1, 2, 3, 0};
+		CHECK(hash_value(l) == hash_value(std::list<int>{1, 2, 3}));
+		CHECK(hash_value(l) != hash_value(l2));
+
+		std::vector<std::string> vs = {"a", "bc"};
+		std::vector<std::string> vs2 = {"ab", "c"};
+		CHECK(hash_value(vs) != hash_value(vs2));
+
+		CHECK(ranges::models::HashableValue<std::vector<std::vector<int>>>);
+		CHECK(!ranges::models::HashableValue<opaque>);
+		CHECK(!ranges::models::HashableValue<std::vector<opaque>>);
+
+		ranges::ext::hasher h;
+		CHECK(h(s) == hash_value(s));
+	}
+
+	void test_hash_range() {
+		using ranges::ext::hash_range;
+		using ranges::ext::hash_value;
+		std::vector<int> v = {1, 2, 3, 4, 5};
+		std::list<int> l(v.begin(), v.end());
+		const int a[] = {1, 2, 3, 4, 5};
+		// The range and iterator forms agree. Contiguous ints are hashed
+		// as bytes, as hash_value hashes a vector of them.
+		CHECK(hash_range(v) == hash_range(v.begin(), v.end()));
+		CHECK(hash_range(v) == hash_range(v.cbegin(), v.cend()));
+		CHECK(hash_range(v) == hash_range(v.data(), v.data() + v.size()));
+		CHECK(hash_range(v) == hash_range(a));
+		CHECK(hash_range(v) == ranges::ext::hash_bytes(v.data(), v.size() * sizeof(int)));
+		CHECK(hash_range(v) == hash_value(v));
+		CHECK(hash_range(l) == hash_range(l.begin(), l.end()));
+		CHECK(hash_range(l) == hash_value(l));
+		CHECK(hash_range(l) != hash_range(v));
+		std::vector<int> e;
+		CHECK(hash_range(e) == hash_range(e.begin(), e.end()));
+		CHECK(hash_range(e) == hash_range(a, a));
+
+		std::string s = "contiguous";
+		CHECK(hash_range(s) == hash_value(s));
+		CHECK(hash_range(s.begin(), s.end()) == hash_range(s.data(), s.data() + s.size()));
+
+		// Projections see the elements in order, and are folded.
+		auto neg = [](int i) { return -i; };
+		std::list<int> nl = {-1, -2, -3, -4, -5};
+		CHECK(hash_range(v, neg) == hash_range(nl.begin(), nl.end()));
+		CHECK(hash_range(v, neg) != hash_range(l.begin(), l.end()));
+
+		struct rec { std::string name; int id; };
+		std::vector<rec> rs = {{"x", 1}, {"y", 2}};
+		std::vector<std::string> names = {"x", "y"};
+		CHECK(hash_range(rs, &rec::name) == hash_range(names));
+	}
+
+	void test_hash_combine() {
+		std::size_t a = 0, b = 0;
+		ranges::ext::hash_combine(a, 1);
+		ranges::ext::hash_combine(a, 2);
+		ranges::ext::hash_combine(b, 2);
+		ranges::ext::hash_combine(b, 1);
+		CHECK(a != b);
+	}
+}
+
+int main() {
+	test_bytes();
+	test_trivially_hashable();
+	test_hash_value();
+	test_hash_range();
+	test_hash_combine();
+	return ::test_result();
+}
@@ -0,0 +1,117 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/random.hpp>
+#include <stl2/detail/random_engine.hpp>
+#include <cstdint>
+#include <random>
+#include <set>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	template <class E>
+	void test_common() {
+		static_assert(ranges::models::UniformRandomNumberGenerator<E>, "");
+		static_assert(E::min() == 0u, "");
+		static_assert(E::max() == ~std::uint64_t{0}, "");
+
+		E a, b;
+		CHECK(a == b);
+		auto const first = a();
+		CHECK(a != b);
+		CHECK(b() == first);
+		CHECK(a == b);
+
+		E c{42}, d{43};
+		CHECK(c() != d());
+
+		// discard(n) is n calls.
+		E e{7}, f{7};
+		for (int i = 0; i < 1000; ++i) {
+			e();
+		}
+		f.discard(1000);
+		CHECK(e == f);
+		CHECK(e() == f());
+
+		ranges::seed_seq q{1, 2, 3};
+		E g{q};
+		ranges::seed_seq q2{1, 2, 3};
+		E h{7};
+		h.seed(q2);
+		CHECK(g == h);
+
+		// Usable with the standard distributions.
+		std::uniform_int_distribution<int> dist{1, 6};
+		std::set<int> seen;
+		for (int i = 0; i < 1000; ++i) {
+			seen.insert(dist(g));
+		}
+		CHECK(seen.size() == 6u);
+	}
+
+	template <class E>
+	void test_jump() {
+		E a{1}, b{1};
+		b.jump();
+		CHECK(a != b);
+		E c{1};
+		c.jump();
+		CHECK(b == c);
+		std::set<std::uint64_t> outs;
+		for (int i = 0; i < 100; ++i) {
+			outs.insert(a());
+			outs.insert(b());
+		}
+		CHECK(outs.size() == 200u);
+		E d{1};
+		d.long_jump();
+		CHECK(d != a);
+		CHECK(d != b);
+	}
+
+	void test_values() {
+		// Reference outputs from the authors' implementations.
+		ranges::ext::splitmix64 sm{0};
+		CHECK(sm() == 0xe220a8397b1dcdafull);
+		CHECK(sm() == 0x6e789e6aa1b965f4ull);
+
+		ranges::ext::xoshiro256pp x{0};
+		ranges::ext::splitmix64 seeder{0};
+		std::uint64_t s[4];
+		for (auto& w : s) {
+			w = seeder();
+		}
+		auto rotl = [](std::uint64_t v, int k) { return (v << k) | (v >> (64 - k)); };
+		CHECK(x() == rotl(s[0] + s[3], 23) + s[0]);
+
+#if defined(__SIZEOF_INT128__)
+		ranges::ext::pcg64 p{42, 54};
+		CHECK(p() == 0x86b1da1d72062b68ull);
+		CHECK(p() == 0x1304aa46c9853d39ull);
+		CHECK(p() == 0xa3670e9e0dd50358ull);
+#endif
+	}
+}
+
+int main() {
+	test_common<ranges::ext::splitmix64>();
+	test_common<ranges::ext::xoshiro256pp>();
+	test_jump<ranges::ext::xoshiro256pp>();
+#if defined(__SIZEOF_INT128__)
+	test_common<ranges::ext::pcg64>();
+	test_jump<ranges::ext::pcg64>();
+#endif
+	test_values();
+	return ::test_result();
+}
@@ -0,0 +1,328 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/scratch_resource.hpp>
+#include <stl2/detail/huge_page_resource.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/inplace_merge.hpp>
+#include <stl2/detail/algorithm/is_partitioned.hpp>
+#include <stl2/detail/algorithm/is_sorted.hpp>
+#include <stl2/detail/algorithm/stable_partition.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct counting_resource : ranges::ext::scratch_resource {
+		int live = 0;
+		int allocations = 0;
+		std::size_t limit = ~std::size_t{0};
+
+	protected:
+		void* do_allocate(std::size_t bytes, std::size_t) noexcept override {
+			if (bytes > limit) {
+				return nullptr;
+			}
+			++live;
+			++allocations;
+			return ::operator new(bytes, std::nothrow);
+		}
+
+		void do_deallocate(void* p, std::size_t, std::size_t) noexcept override {
+			--live;
+			::operator delete(p);
+		}
+	};
+
+	// Hands out the same block for any request, however large.
+	struct arena_resource : ranges::ext::scratch_resource {
+		alignas(std::max_align_t) unsigned char block[256];
+		void* freed = nullptr;
+
+	protected:
+		void* do_allocate(std::size_t, std::size_t) noexcept override {
+			return block;
+		}
+
+		void do_deallocate(void* p, std::size_t, std::size_t) noexcept override {
+			freed = p;
+		}
+	};
+
+	struct pair_key {
+		int key;
+		int index;
+	};
+
+	std::vector<pair_key> make_input(int n) {
+		std::vector<pair_key> v;
+		for (int i = 0; i < n; ++i) {
+			v.push_back({(i * 7919) % 97, i});
+		}
+		return v;
+	}
+
+	bool stably_sorted(const std::vector<pair_key>& v) {
+		for (std::size_t i = 1; i < v.size(); ++i) {
+			if (v[i].key < v[i - 1].key ||
+				(v[i].key == v[i - 1].key && v[i].index < v[i - 1].index)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void test_stats() {
+		counting_resource r;
+		{
+			auto buf = ranges::detail::temporary_buffer<int>{100, r};
+			CHECK(buf.size() == 100);
+			CHECK(r.live == 1);
+		}
+		CHECK(r.live == 0);
+		auto s = r.stats();
+		CHECK(s.requests == 1u);
+		CHECK(s.bytes_requested == 100 * sizeof(int));
+		CHECK(s.bytes_allocated == 100 * sizeof(int));
+		CHECK(s.fallbacks == 0u);
+
+		r.limit = 40 * sizeof(int);
+		{
+			auto buf = ranges::detail::temporary_buffer<int>{100, r};
+			CHECK(buf.size() == 25);
+		}
+		s = r.stats();
+		CHECK(s.requests == 2u);
+		CHECK(s.fallbacks == 1u);
+
+		r.limit = 0;
+		{
+			auto buf = ranges::detail::temporary_buffer<int>{100, r};
+			CHECK(buf.size() == 0);
+			CHECK(buf.data() == nullptr);
+		}
+		CHECK(r.stats().fallbacks == 2u);
+		CHECK(r.live == 0);
+
+		r.reset_stats();
+		CHECK(r.stats().requests == 0u);
+	}
+
+	void test_monotonic() {
+		alignas(std::max_align_t) unsigned char arena[1024];
+		ranges::ext::monotonic_scratch_resource r{arena, sizeof(arena)};
+		void* a = r.allocate(100);
+		void* b = r.allocate(100);
+		CHECK(a == arena);
+		CHECK(b != a);
+		CHECK(r.allocate(2048) == nullptr);
+		r.deallocate(b, 100);
+		r.deallocate(a, 100);
+		CHECK(r.bytes_in_use() == 0u);
+		void* d = r.allocate(10, 64);
+		CHECK((reinterpret_cast<std::uintptr_t>(d) % 64) == 0u);
+		r.release();
+		CHECK(r.bytes_in_use() == 0u);
+
+		counting_resource upstream;
+		ranges::ext::monotonic_scratch_resource r2{arena, sizeof(arena), &upstream};
+		void* c = r2.allocate(2048);
+		CHECK(c != nullptr);
+		CHECK(upstream.live == 1);
+		r2.deallocate(c, 2048);
+		CHECK(upstream.live == 0);
+	}
+
+	void test_pool() {
+		counting_resource upstream;
+		{
+			ranges::ext::pool_scratch_resource r{&upstream};
+			for (int i = 0; i < 10; ++i) {
+				auto buf = ranges::detail::temporary_buffer<int>{1000, r};
+				CHECK(buf.size() == 1000);
+			}
+			CHECK(upstream.allocations == 1);
+			CHECK(upstream.live == 1);
+		}
+		CHECK(upstream.live == 0);
+
+		{
+			ranges::ext::pool_scratch_resource r{&upstream, 8192};
+			{
+				auto a = ranges::detail::temporary_buffer<int>{1000, r};
+				auto b = ranges::detail::temporary_buffer<int>{1000, r};
+				auto c = ranges::detail::temporary_buffer<int>{1000, r};
+			}
+			// Only two 4K blocks fit under the limit.
+			CHECK(r.cached_bytes() == 8192u);
+			CHECK(upstream.live == 2);
+			CHECK(r.trim(4096) == 4096u);
+			CHECK(upstream.live == 1);
+		}
+		CHECK(upstream.live == 0);
+	}
+
+	void test_cache() {
+		CHECK(!ranges::ext::scratch_cache_enabled());
+		CHECK(!ranges::ext::set_scratch_cache_enabled(true));
+		auto& cache = ranges::ext::thread_scratch_cache();
+		CHECK(ranges::ext::get_default_scratch_resource() == &cache);
+
+		void* first;
+		{
+			auto buf = ranges::detail::temporary_buffer<int>{1000};
+			first = buf.data();
+		}
+		CHECK(cache.cached_bytes() == 4096u);
+		{
+			auto buf = ranges::detail::temporary_buffer<int>{900};
+			CHECK(buf.data() == first);
+		}
+
+		struct alignas(128) big { char c[128]; };
+		{
+			auto buf = ranges::detail::temporary_buffer<big>{100};
+			CHECK(buf.size() == 100);
+		}
+
+		// Once warm, repeated sorts of similar size are served from the
+		// cache without touching the heap.
+		auto warm = make_input(1000);
+		ranges::stable_sort(warm, ranges::less<>{}, &pair_key::key);
+		auto const cached = cache.cached_bytes();
+		cache.reset_stats();
+		for (int i = 0; i < 4; ++i) {
+			auto v = make_input(1000 + i);
+			ranges::stable_sort(v, ranges::less<>{}, &pair_key::key);
+			CHECK(stably_sorted(v));
+		}
+		CHECK(cache.stats().requests == 4u);
+		CHECK(cache.stats().fallbacks == 0u);
+		CHECK(cache.cached_bytes() == cached);
+
+		ranges::ext::set_scratch_cache_limit(4096);
+		CHECK(cache.cached_bytes() <= 4096u);
+		ranges::ext::trim_scratch_cache();
+		CHECK(cache.cached_bytes() == 0u);
+
+		CHECK(ranges::ext::set_scratch_cache_enabled(false));
+		CHECK(ranges::ext::get_default_scratch_resource() ==
+			ranges::ext::new_delete_scratch_resource());
+	}
+
+	void test_huge_pages() {
+		counting_resource upstream;
+		ranges::ext::huge_page_scratch_resource r{std::size_t{1} << 20, &upstream};
+		{
+			auto small = ranges::detail::temporary_buffer<int>{1000, r};
+			CHECK(small.size() == 1000);
+			CHECK(upstream.live == 1);
+			auto big = ranges::detail::temporary_buffer<int>{1 << 20, r};
+			CHECK(big.size() == (1 << 20));
+			CHECK(upstream.live == 1);
+			CHECK((reinterpret_cast<std::uintptr_t>(big.data()) %
+				ranges::ext::huge_page_scratch_resource::huge_page_size) == 0u);
+			big.data()[(1 << 20) - 1] = 42;
+		}
+		CHECK(upstream.live == 0);
+
+		ranges::ext::huge_page_scratch_resource mapped{std::size_t{1} << 16, &upstream};
+		auto v = make_input(100000);
+		ranges::stable_sort(mapped, v, ranges::less<>{}, &pair_key::key);
+		CHECK(stably_sorted(v));
+		CHECK(mapped.stats().fallbacks == 0u);
+		CHECK(upstream.live == 0);
+
+		// A request too large to map goes to upstream.
+		arena_resource arena;
+		ranges::ext::huge_page_scratch_resource unmappable{std::size_t{1} << 20, &arena};
+		auto const huge = std::size_t{1} << 62;
+		auto const p = static_cast<unsigned char*>(unmappable.allocate(huge));
+		CHECK(p != nullptr);
+		CHECK(p > arena.block);
+		CHECK(p < arena.block + sizeof(arena.block));
+		unmappable.deallocate(p, huge);
+		CHECK(arena.freed == static_cast<void*>(arena.block));
+	}
+
+	void test_algorithms() {
+		auto v = make_input(5000);
+		auto by_key = [](const pair_key& p) { return p.key; };
+
+		alignas(std::max_align_t) static unsigned char arena[1 << 16];
+		ranges::ext::monotonic_scratch_resource r{arena, sizeof(arena)};
+		ranges::stable_sort(r, v, ranges::less<>{}, by_key);
+		CHECK(stably_sorted(v));
+		CHECK(r.stats().requests >= 1u);
+		CHECK(r.stats().fallbacks == 0u);
+		CHECK(r.bytes_in_use() == 0u);
+
+		// A buffer too small for the whole input still yields a stable
+		// result, through the slower path, and the shortfall is recorded.
+		v = make_input(5000);
+		ranges::ext::monotonic_scratch_resource small{arena, 1024};
+		ranges::stable_sort(small, v.begin(), v.end(), ranges::less<>{}, by_key);
+		CHECK(stably_sorted(v));
+		CHECK(small.stats().fallbacks >= 1u);
+
+		v = make_input(5000);
+		r.reset_stats();
+		auto is_odd = [](int i) { return i % 2 != 0; };
+		auto odd = std::count_if(v.begin(), v.end(),
+			[&](const pair_key& x) { return is_odd(x.key); });
+		auto p = ranges::stable_partition(r, v, is_odd, by_key);
+		CHECK(ranges::is_partitioned(v, is_odd, by_key));
+		CHECK((p - v.begin()) == odd);
+		CHECK(r.stats().requests == 1u);
+
+		v = make_input(5000);
+		auto middle = v.begin() + 2000;
+		ranges::stable_sort(v.begin(), middle, ranges::less<>{}, by_key);
+		ranges::stable_sort(middle, v.end(), ranges::less<>{}, by_key);
+		r.reset_stats();
+		ranges::inplace_merge(r, v.begin(), middle, v.end(), ranges::less<>{}, by_key);
+		CHECK(ranges::is_sorted(v, ranges::less<>{}, by_key));
+		CHECK(r.stats().requests == 1u);
+	}
+
+	void test_default() {
+		CHECK(ranges::ext::get_default_scratch_resource() ==
+			ranges::ext::new_delete_scratch_resource());
+		counting_resource r;
+		{
+			ranges::ext::scoped_scratch_resource _{r};
+			CHECK(ranges::ext::get_default_scratch_resource() == &r);
+			auto v = make_input(1000);
+			ranges::stable_sort(v, ranges::less<>{}, &pair_key::key);
+			CHECK(stably_sorted(v));
+			CHECK(r.stats().requests == 1u);
+			CHECK(r.live == 0);
+		}
+		CHECK(ranges::ext::get_default_scratch_resource() ==
+			ranges::ext::new_delete_scratch_resource());
+	}
+}
+
+int main() {
+	test_stats();
+	test_monotonic();
+	test_pool();
+	test_cache();
+	test_huge_pages();
+	test_algorithms();
+	test_default();
+	return ::test_result();
+}
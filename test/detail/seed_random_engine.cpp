@@ -0,0 +1,102 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/randutils.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	using result_t = ranges::detail::default_random_engine::result_type;
+
+	result_t draw() {
+		return ranges::detail::get_random_engine()();
+	}
+
+	result_t draw_in_thread() {
+		result_t x = 0;
+		std::thread t{[&x] { x = draw(); }};
+		t.join();
+		return x;
+	}
+}
+
+int main() {
+	// Threads seed their engines differently.
+	{
+		auto const a = draw_in_thread();
+		auto const b = draw_in_thread();
+		CHECK(a != b);
+	}
+
+	// A fixed seed reproduces this thread's sequence and then those of
+	// threads started in the same order.
+	{
+		ranges::ext::seed_random_engine(42);
+		auto const a0 = draw(), a1 = draw();
+		auto const t0 = draw_in_thread(), t1 = draw_in_thread();
+		CHECK(a0 != a1);
+		CHECK(t0 != t1);
+		CHECK(a0 != t0);
+
+		ranges::ext::seed_random_engine(42);
+		CHECK(draw() == a0);
+		CHECK(draw() == a1);
+		CHECK(draw_in_thread() == t0);
+		CHECK(draw_in_thread() == t1);
+
+		ranges::ext::seed_random_engine(43);
+		CHECK(draw() != a0);
+	}
+
+	// A thread that drew before a reseed picks it up at its next use.
+	{
+		ranges::ext::seed_random_engine(7);
+		auto const t0 = draw_in_thread();
+
+		ranges::ext::seed_random_engine(7);
+		std::mutex m;
+		std::condition_variable cv;
+		int step = 0;
+		result_t before = 0, after = 0;
+		std::thread t{[&] {
+			before = draw();
+			std::unique_lock<std::mutex> lock{m};
+			step = 1;
+			cv.notify_one();
+			cv.wait(lock, [&] { return step == 2; });
+			after = draw();
+		}};
+		{
+			std::unique_lock<std::mutex> lock{m};
+			cv.wait(lock, [&] { return step == 1; });
+			ranges::ext::seed_random_engine(7);
+			step = 2;
+		}
+		cv.notify_one();
+		t.join();
+		CHECK(before == t0);
+		CHECK(after == t0);
+	}
+
+	// Back to fresh entropy.
+	{
+		ranges::ext::seed_random_engine(42);
+		auto const a0 = draw();
+		ranges::ext::seed_random_engine();
+		CHECK(draw() != a0);
+	}
+
+	return ::test_result();
+}
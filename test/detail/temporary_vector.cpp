@@ -1,8 +1,13 @@
 #include <stl2/detail/temporary_vector.hpp>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
 #include "../simple_test.hpp"
 
 namespace ranges = __stl2;
 
+using ranges::detail::scratch_vector;
 using ranges::detail::temporary_buffer;
 using ranges::detail::temporary_vector;
 
@@ -29,9 +34,86 @@ namespace {
 	void test_alignments() {
 		(test_single_alignment<Alignments>(), ...);
 	}
+
+	void test_scratch_vector() {
+		{
+			scratch_vector<int, 4> v;
+			int* const inline_data = v.begin();
+			CHECK(v.capacity() == 4);
+			for (int i = 0; i < 4; ++i) {
+				v.push_back(i);
+			}
+			CHECK(v.begin() == inline_data);
+			for (int i = 4; i < 100; ++i) {
+				v.push_back(i);
+			}
+			CHECK(v.size() == 100);
+			CHECK(v.begin() != inline_data);
+			for (int i = 0; i < 100; ++i) {
+				CHECK(v[i] == i);
+			}
+
+			auto w = std::move(v);
+			CHECK(w.size() == 100);
+			CHECK(v.empty());
+			CHECK(w[99] == 99);
+
+			scratch_vector<int, 4> x;
+			x.push_back(42);
+			w = std::move(x);
+			CHECK(w.size() == 1);
+			CHECK(w[0] == 42);
+			CHECK(x.empty());
+		}
+
+		{
+			// Without a resource the vector can't outgrow its inline storage.
+			scratch_vector<std::unique_ptr<int>, 2> v{nullptr};
+			CHECK(v.try_reserve(2));
+			CHECK(!v.try_reserve(3));
+			v.push_back(std::make_unique<int>(1));
+			v.push_back(std::make_unique<int>(2));
+			bool threw = false;
+			try {
+				v.push_back(std::make_unique<int>(3));
+			} catch(std::bad_alloc&) {
+				threw = true;
+			}
+			CHECK(threw);
+			CHECK(v.size() == 2);
+			auto w = std::move(v);
+			CHECK(*w[1] == 2);
+		}
+
+		{
+			// Appending one of the vector's own elements when it is full.
+			scratch_vector<std::string, 2> v;
+			v.push_back(std::string(40, 'a'));
+			for (int i = 1; i < 40; ++i) {
+				if (v.size() == v.capacity()) {
+					v.push_back(v[0]);
+				} else {
+					v.push_back(std::string(40, 'a'));
+				}
+			}
+			CHECK(v.size() == 40);
+			for (auto& s : v) {
+				CHECK(s == std::string(40, 'a'));
+			}
+		}
+
+		{
+			scratch_vector<int, 0> v;
+			CHECK(v.capacity() == 0);
+			CHECK(v.try_reserve(1000));
+			CHECK(v.capacity() >= 1000);
+			CHECK(v.empty());
+		}
+	}
 }
 
 int main() {
 	test_alignments<1, 2, 4, 8, 16, 32, 64, 128>();
+	test_scratch_vector();
 	return ::test_result();
 }
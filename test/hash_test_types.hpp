@@ -0,0 +1,36 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_TEST_HASH_TEST_TYPES_HPP
+#define STL2_TEST_HASH_TEST_TYPES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// Equality ignores gen, as must the hash; hashable only through std::hash.
+struct Id {
+	std::uint32_t v, gen;
+
+	friend bool operator==(const Id& a, const Id& b) { return a.v == b.v; }
+	friend bool operator!=(const Id& a, const Id& b) { return !(a == b); }
+};
+
+namespace std {
+	template <>
+	struct hash<::Id> {
+		std::size_t operator()(const ::Id& id) const noexcept {
+			return std::hash<std::uint32_t>{}(id.v);
+		}
+	};
+}
+
+#endif
@@ -11,8 +11,14 @@
 //
 #include <stl2/algorithm.hpp>
 #include <stl2/concepts.hpp>
+#include <stl2/container/flat_hash_map.hpp>
+#include <stl2/container/flat_hash_set.hpp>
+#include <stl2/container/flat_map.hpp>
+#include <stl2/container/flat_set.hpp>
+#include <stl2/container/small_vector.hpp>
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
+#include <stl2/memory.hpp>
 #include <stl2/optional.hpp>
 #include <stl2/random.hpp>
 #include <stl2/tuple.hpp>
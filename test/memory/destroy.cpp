@@ -0,0 +1,69 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/memory/destroy.hpp>
+#include <stl2/iterator.hpp>
+#include <memory>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct counted {
+		static int live;
+		counted() { ++live; }
+		~counted() { --live; }
+	};
+	int counted::live = 0;
+
+	template <class T>
+	struct raw_storage {
+		std::allocator<T> alloc;
+		std::size_t n;
+		T* p;
+
+		explicit raw_storage(std::size_t n) : n{n}, p{alloc.allocate(n)} {
+			for (std::size_t i = 0; i < n; ++i) {
+				::new(static_cast<void*>(p + i)) T;
+			}
+		}
+		~raw_storage() { alloc.deallocate(p, n); }
+		T* begin() const { return p; }
+		T* end() const { return p + n; }
+	};
+}
+
+int main() {
+	{
+		raw_storage<counted> c{10};
+		CHECK(counted::live == 10);
+		ranges::destroy_at(c.p);
+		CHECK(counted::live == 9);
+		CHECK(ranges::destroy_n(c.begin() + 1, 4) == c.begin() + 5);
+		CHECK(counted::live == 5);
+		CHECK(ranges::destroy(
+			forward_iterator<counted*>{c.begin() + 5},
+			sentinel<counted*>{c.end()}).base() == c.end());
+		CHECK(counted::live == 0);
+	}
+	{
+		raw_storage<counted> c{3};
+		CHECK(ranges::destroy(c) == c.end());
+		CHECK(counted::live == 0);
+	}
+	{
+		raw_storage<int> i{8};
+		CHECK(ranges::destroy(i) == i.end());
+		CHECK(ranges::destroy_n(i.begin(), 8) == i.end());
+	}
+	return ::test_result();
+}
@@ -0,0 +1,126 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/memory/uninitialized_copy.hpp>
+#include <stl2/detail/memory/uninitialized_move.hpp>
+#include <stl2/iterator.hpp>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct counted {
+		static int live;
+		static int throw_after;
+		int value;
+
+		counted(int i) : value{i} {
+			if (throw_after >= 0 && throw_after-- == 0) {
+				throw 42;
+			}
+			++live;
+		}
+		counted(const counted& that) : counted(that.value) {}
+		~counted() { --live; }
+	};
+	int counted::live = 0;
+	int counted::throw_after = -1;
+
+	template <class T>
+	struct raw_storage {
+		std::allocator<T> alloc;
+		std::size_t n;
+		T* p;
+
+		explicit raw_storage(std::size_t n) : n{n}, p{alloc.allocate(n)} {}
+		~raw_storage() { alloc.deallocate(p, n); }
+		T* begin() const { return p; }
+		T* end() const { return p + n; }
+	};
+
+	void test_trivial() {
+		int src[] = {1, 2, 3, 4, 5};
+		raw_storage<int> dst{5};
+		auto r = ranges::uninitialized_copy(src, dst.begin());
+		CHECK(r.in() == ranges::end(src));
+		CHECK(r.out() == dst.end());
+		CHECK(std::equal(src, src + 5, dst.begin()));
+
+		raw_storage<int> dst2{3};
+		auto r2 = ranges::uninitialized_copy_n(src, 3, dst2.begin());
+		CHECK(r2.in() == src + 3);
+		CHECK(r2.out() == dst2.end());
+		CHECK(dst2.p[2] == 3);
+
+		// Non-contiguous source: element-wise, with a conversion.
+		raw_storage<long> dst3{5};
+		auto r3 = ranges::uninitialized_copy(
+			input_iterator<const int*>{src}, sentinel<const int*>{src + 5},
+			dst3.begin());
+		CHECK(r3.in().base() == src + 5);
+		CHECK(dst3.p[4] == 5L);
+
+		auto r4 = ranges::uninitialized_copy_n(
+			input_iterator<const int*>{src}, 2, dst3.begin());
+		CHECK(r4.in().base() == src + 2);
+		CHECK(r4.out() == dst3.begin() + 2);
+	}
+
+	void test_strings() {
+		std::vector<std::string> src = {"alpha", "beta", "gamma"};
+		raw_storage<std::string> dst{3};
+		auto r = ranges::uninitialized_copy(src, dst.begin());
+		CHECK(r.out() == dst.end());
+		CHECK(dst.p[1] == "beta");
+		CHECK(src[1] == "beta");
+		ranges::destroy(dst);
+
+		auto m = ranges::uninitialized_move(src, dst.begin());
+		CHECK(m.in() == src.end());
+		CHECK(dst.p[2] == "gamma");
+		ranges::destroy(dst);
+
+		src = {"alpha", "beta", "gamma"};
+		auto mn = ranges::uninitialized_move_n(src.begin(), 2, dst.begin());
+		CHECK(mn.in() == src.begin() + 2);
+		CHECK(dst.p[0] == "alpha");
+		ranges::destroy_n(dst.begin(), 2);
+	}
+
+	void test_exception() {
+		std::vector<counted> src = {1, 2, 3, 4, 5};
+		CHECK(counted::live == 5);
+		raw_storage<counted> dst{5};
+		counted::throw_after = 3;
+		bool caught = false;
+		try {
+			ranges::uninitialized_copy(src, dst.begin());
+		} catch(int) {
+			caught = true;
+		}
+		counted::throw_after = -1;
+		CHECK(caught);
+		// The three copies made before the throw were destroyed.
+		CHECK(counted::live == 5);
+	}
+}
+
+int main() {
+	test_trivial();
+	test_strings();
+	test_exception();
+	return ::test_result();
+}
@@ -0,0 +1,152 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/memory/uninitialized_fill.hpp>
+#include <stl2/detail/memory/uninitialized_default_construct.hpp>
+#include <stl2/detail/memory/uninitialized_value_construct.hpp>
+#include <stl2/iterator.hpp>
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <string>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct counted {
+		static int live;
+		static int throw_after;
+		int value = 7;
+
+		counted() {
+			if (throw_after >= 0 && throw_after-- == 0) {
+				throw 42;
+			}
+			++live;
+		}
+		counted(const counted& that) : counted() { value = that.value; }
+		~counted() { --live; }
+	};
+	int counted::live = 0;
+	int counted::throw_after = -1;
+
+	template <class T>
+	struct raw_storage {
+		std::allocator<T> alloc;
+		std::size_t n;
+		T* p;
+
+		explicit raw_storage(std::size_t n) : n{n}, p{alloc.allocate(n)} {}
+		~raw_storage() { alloc.deallocate(p, n); }
+		T* begin() const { return p; }
+		T* end() const { return p + n; }
+	};
+
+	enum class color { red, green };
+	struct pod { int i; double d; };
+
+	void test_fill() {
+		raw_storage<int> a{100};
+		CHECK(ranges::uninitialized_fill(a, 0) == a.end());
+		CHECK(std::count(a.begin(), a.end(), 0) == 100);
+		CHECK(ranges::uninitialized_fill(a.begin(), a.end(), -1) == a.end());
+		CHECK(std::count(a.begin(), a.end(), -1) == 100);
+		// Bytes differ: element-wise.
+		CHECK(ranges::uninitialized_fill_n(a.begin(), 50, 0x01020304) == a.begin() + 50);
+		CHECK(std::count(a.begin(), a.end(), 0x01020304) == 50);
+		CHECK(a.p[50] == -1);
+
+		raw_storage<std::string> s{10};
+		ranges::uninitialized_fill(s, std::string{"xyz"});
+		CHECK(std::count(s.begin(), s.end(), "xyz") == 10);
+		ranges::destroy(s);
+
+		raw_storage<counted> c{10};
+		counted::throw_after = 6;
+		bool caught = false;
+		try {
+			ranges::uninitialized_fill(c, counted{});
+		} catch(int) {
+			caught = true;
+		}
+		counted::throw_after = -1;
+		CHECK(caught);
+		CHECK(counted::live == 0);
+	}
+
+	void test_default_construct() {
+		raw_storage<int> a{10};
+		CHECK(ranges::uninitialized_default_construct(a) == a.end());
+		CHECK(ranges::uninitialized_default_construct_n(a.begin(), 5) == a.begin() + 5);
+
+		raw_storage<counted> c{10};
+		CHECK(ranges::uninitialized_default_construct(c.begin(), c.end()) == c.end());
+		CHECK(counted::live == 10);
+		CHECK(c.p[9].value == 7);
+		ranges::destroy(c);
+		CHECK(counted::live == 0);
+
+		counted::throw_after = 4;
+		bool caught = false;
+		try {
+			ranges::uninitialized_default_construct_n(c.begin(), 10);
+		} catch(int) {
+			caught = true;
+		}
+		counted::throw_after = -1;
+		CHECK(caught);
+		CHECK(counted::live == 0);
+	}
+
+	void test_value_construct() {
+		raw_storage<double> d{20};
+		std::fill(d.begin(), d.end(), 1.5);
+		CHECK(ranges::uninitialized_value_construct(d) == d.end());
+		CHECK(std::count(d.begin(), d.end(), 0.0) == 20);
+
+		raw_storage<int*> p{5};
+		CHECK(ranges::uninitialized_value_construct_n(p.begin(), 5) == p.end());
+		CHECK(std::count(p.begin(), p.end(), nullptr) == 5);
+
+		raw_storage<color> e{5};
+		ranges::uninitialized_value_construct(e);
+		CHECK(e.p[4] == color::red);
+
+		raw_storage<pod> q{5};
+		std::memset(q.p, 0xff, 5 * sizeof(pod));
+		ranges::uninitialized_value_construct(q);
+		CHECK(q.p[3].i == 0);
+		CHECK(q.p[3].d == 0.0);
+
+		raw_storage<std::string> s{4};
+		ranges::uninitialized_value_construct(s);
+		CHECK(s.p[3].empty());
+		ranges::destroy(s);
+	}
+
+	void test_non_contiguous() {
+		std::list<int> l(10, 5);
+		CHECK(ranges::uninitialized_fill(l, 3) == l.end());
+		CHECK(std::count(l.begin(), l.end(), 3) == 10);
+		CHECK(ranges::uninitialized_value_construct(l) == l.end());
+		CHECK(std::count(l.begin(), l.end(), 0) == 10);
+	}
+}
+
+int main() {
+	test_fill();
+	test_default_construct();
+	test_value_construct();
+	test_non_contiguous();
+	return ::test_result();
+}
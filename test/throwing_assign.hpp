@@ -0,0 +1,47 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_TEST_THROWING_ASSIGN_HPP
+#define STL2_TEST_THROWING_ASSIGN_HPP
+
+// An element whose move assignment may throw, and does when assigned
+// from the value -1. Counts the live objects so a test can check that
+// an algorithm leaves none behind in a buffer.
+struct throwing_assign
+{
+	int i;
+
+	static int& live() noexcept
+	{
+		static int n = 0;
+		return n;
+	}
+
+	throwing_assign(int i) : i{i} { ++live(); }
+	throwing_assign(const throwing_assign& that) noexcept : i{that.i} { ++live(); }
+	throwing_assign(throwing_assign&& that) noexcept : i{that.i} { ++live(); }
+	~throwing_assign() { --live(); }
+	throwing_assign& operator=(const throwing_assign& that) noexcept
+	{
+		i = that.i;
+		return *this;
+	}
+	throwing_assign& operator=(throwing_assign&& that) noexcept(false)
+	{
+		if (that.i == -1) {
+			throw that.i;
+		}
+		i = that.i;
+		return *this;
+	}
+};
+
+#endif
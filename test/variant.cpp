@@ -845,6 +845,21 @@ struct print_fn {
 	}
 };
 
+template <std::size_t I>
+struct indexed {
+	int value;
+};
+
+template <std::size_t...Is>
+variant<indexed<Is>...> make_indexed_variant(std::index_sequence<Is...>);
+
+struct sum_values {
+	template <std::size_t...Is>
+	constexpr int operator()(const indexed<Is>&...xs) const {
+		return (0 + ... + xs.value);
+	}
+};
+
 void test_visit() {
 	{
 		using V = variant<int, double, void, nontrivial_literal>;
@@ -924,6 +939,28 @@ void test_visit() {
 		static_assert(visit(f, V{42ull}, V{42ll}) == 84ull);
 		static_assert(visit(f, V{42ull}, V{42ull}) == 84ull);
 	}
+
+	{
+		// Any number of alternatives dispatches in constant time.
+		using V = decltype(make_indexed_variant(std::make_index_sequence<48>{}));
+		auto index_and_value = [](auto i, const auto& x) {
+			return static_cast<int>(i()) * 1000 + x.value;
+		};
+		CHECK(visit_with_index(index_and_value, V{emplaced_index<0>, indexed<0>{1}}) == 1);
+		CHECK(visit_with_index(index_and_value, V{emplaced_index<29>, indexed<29>{2}}) == 29002);
+		CHECK(visit_with_index(index_and_value, V{emplaced_index<47>, indexed<47>{3}}) == 47003);
+
+		constexpr V a{emplaced_index<5>, indexed<5>{1}};
+		constexpr V b{emplaced_index<46>, indexed<46>{20}};
+		static_assert(visit(sum_values{}, a) == 1);
+		static_assert(visit(sum_values{}, a, b) == 21);
+		static_assert(visit(sum_values{}, b, a) == 21);
+		static_assert(visit(sum_values{}, b, b) == 40);
+
+		CHECK(visit_with_indices([](auto i, const auto&...) {
+			return is_same<decltype(i), std::index_sequence<46, 5>>::value;
+		}, b, a));
+	}
 }
 
 void test_tagged() {